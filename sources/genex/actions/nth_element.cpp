@@ -0,0 +1,48 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.actions.nth_element;
+export import genex.pipe;
+import genex.concepts;
+import genex.iterators.iter_pair;
+import genex.meta;
+import genex.operations.cmp;
+import std;
+
+namespace genex::actions::detail::concepts {
+    template <typename Rng, typename Int, typename Comp, typename Proj>
+    concept can_nth_element_range =
+        random_access_range<Rng> and
+        std::integral<Int> and
+        std::sortable<iterator_t<Rng>, Comp, Proj>;
+}
+
+namespace genex::actions {
+    struct nth_element_fn {
+        /**
+         * Rearranges the range so that position @c k holds the element a full sort would put there, with no element
+         * before it ordered after it and none after it ordered before it. Runs in O(n) on average. A @c k past the end,
+         * or a negative one, leaves the range untouched.
+         */
+        template <typename Rng, typename Int, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires detail::concepts::can_nth_element_range<Rng, Int, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, const Int k, Comp comp = {}, Proj proj = {}) const -> decltype(auto) {
+            auto [first, last] = iterators::iter_pair(rng);
+            auto sorter = [&]<typename Lhs, typename Rhs>(Lhs &&lhs, Rhs &&rhs) {
+                return meta::invoke(comp, meta::invoke(proj, std::forward<Lhs>(lhs)), meta::invoke(proj, std::forward<Rhs>(rhs)));
+            };
+            const auto n = last - first;
+            const auto nth = first + (std::cmp_less(k, 0) ? 0 : std::cmp_less(k, n) ? static_cast<decltype(n)>(k) : n);
+            std::nth_element(first, nth, last, std::move(sorter));
+            return std::forward<Rng>(rng);
+        }
+
+        template <typename Int, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires std::integral<Int>
+        GENEX_INLINE constexpr auto operator()(const Int k, Comp comp = {}, Proj proj = {}) const {
+            return meta::bind_back(nth_element_fn{}, k, std::move(comp), std::move(proj));
+        }
+    };
+
+    export inline constexpr nth_element_fn nth_element{};
+}
@@ -0,0 +1,48 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.actions.partial_sort;
+export import genex.pipe;
+import genex.concepts;
+import genex.iterators.iter_pair;
+import genex.meta;
+import genex.operations.cmp;
+import std;
+
+namespace genex::actions::detail::concepts {
+    template <typename Rng, typename Int, typename Comp, typename Proj>
+    concept can_partial_sort_range =
+        random_access_range<Rng> and
+        std::integral<Int> and
+        std::sortable<iterator_t<Rng>, Comp, Proj>;
+}
+
+namespace genex::actions {
+    struct partial_sort_fn {
+        /**
+         * Rearranges the range so that its first @c k positions hold the @c k elements that would come first in a
+         * full sort, in sorted order; the order of the remaining elements is unspecified. Runs in O(n log k). @c k is
+         * clamped to @c [0, size], so a negative @c k leaves the range untouched and one past the end sorts it fully.
+         */
+        template <typename Rng, typename Int, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires detail::concepts::can_partial_sort_range<Rng, Int, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, const Int k, Comp comp = {}, Proj proj = {}) const -> decltype(auto) {
+            auto [first, last] = iterators::iter_pair(rng);
+            auto sorter = [&]<typename Lhs, typename Rhs>(Lhs &&lhs, Rhs &&rhs) {
+                return meta::invoke(comp, meta::invoke(proj, std::forward<Lhs>(lhs)), meta::invoke(proj, std::forward<Rhs>(rhs)));
+            };
+            const auto n = last - first;
+            const auto mid = first + (std::cmp_less(k, 0) ? 0 : std::cmp_less(k, n) ? static_cast<decltype(n)>(k) : n);
+            std::partial_sort(first, mid, last, std::move(sorter));
+            return std::forward<Rng>(rng);
+        }
+
+        template <typename Int, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires std::integral<Int>
+        GENEX_INLINE constexpr auto operator()(const Int k, Comp comp = {}, Proj proj = {}) const {
+            return meta::bind_back(partial_sort_fn{}, k, std::move(comp), std::move(proj));
+        }
+    };
+
+    export inline constexpr partial_sort_fn partial_sort{};
+}
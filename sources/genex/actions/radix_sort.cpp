@@ -0,0 +1,297 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.actions.radix_sort;
+export import genex.pipe;
+import genex.concepts;
+import genex.iterators.iter_pair;
+import genex.meta;
+import std;
+
+namespace genex::actions::detail::impl {
+    /**
+     * Maps a key to an unsigned image whose byte-wise (little end first) order matches the key's natural order, and
+     * extracts its bytes. Signed integers have their sign bit flipped; IEEE floats have every bit flipped when
+     * negative and only the sign bit flipped otherwise, so negative values sort below positive ones and -0.0 below
+     * +0.0. Tuples and pairs concatenate the images of their elements, the first element being the most significant.
+     */
+    template <typename K>
+    struct radix_traits;
+
+    template <typename K>
+    requires std::unsigned_integral<K> and (not std::same_as<K, bool>)
+    struct radix_traits<K> {
+        using key_type = K;
+        static constexpr std::size_t width = sizeof(K);
+
+        GENEX_INLINE static constexpr auto encode(const K k) noexcept -> key_type {
+            return k;
+        }
+
+        GENEX_INLINE static constexpr auto digit(const key_type key, const std::size_t d) noexcept -> std::uint8_t {
+            return static_cast<std::uint8_t>(key >> (8 * d));
+        }
+    };
+
+    template <>
+    struct radix_traits<bool> : radix_traits<std::uint8_t> {
+        GENEX_INLINE static constexpr auto encode(const bool k) noexcept -> key_type {
+            return static_cast<key_type>(k);
+        }
+    };
+
+    template <std::signed_integral K>
+    struct radix_traits<K> : radix_traits<std::make_unsigned_t<K>> {
+        using key_type = std::make_unsigned_t<K>;
+
+        GENEX_INLINE static constexpr auto encode(const K k) noexcept -> key_type {
+            return static_cast<key_type>(static_cast<key_type>(k) ^ (key_type{1} << (8 * sizeof(K) - 1)));
+        }
+    };
+
+    template <std::floating_point K>
+    requires std::numeric_limits<K>::is_iec559 and (sizeof(K) == 4 or sizeof(K) == 8)
+    struct radix_traits<K> : radix_traits<std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>> {
+        using key_type = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+
+        GENEX_INLINE static constexpr auto encode(const K k) noexcept -> key_type {
+            constexpr auto sign = key_type{1} << (8 * sizeof(K) - 1);
+            const auto bits = std::bit_cast<key_type>(k);
+            return (bits & sign) ? static_cast<key_type>(~bits) : static_cast<key_type>(bits | sign);
+        }
+    };
+
+    template <typename Tup, typename... Ks>
+    requires (requires { radix_traits<std::remove_cvref_t<Ks>>::width; } and ...)
+    struct radix_composite_traits {
+        using key_type = std::array<std::uint8_t, (radix_traits<std::remove_cvref_t<Ks>>::width + ...)>;
+        static constexpr std::size_t width = std::tuple_size_v<key_type>;
+
+        GENEX_INLINE static constexpr auto encode(Tup const &tup) noexcept -> key_type {
+            auto out = key_type{};
+            auto pos = 0uz;
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (put<sizeof...(Ks) - 1 - Is>(out, pos, tup), ...);
+            }(std::index_sequence_for<Ks...>{});
+            return out;
+        }
+
+        GENEX_INLINE static constexpr auto digit(key_type const &key, const std::size_t d) noexcept -> std::uint8_t {
+            return key[d];
+        }
+
+    private:
+        template <std::size_t I>
+        GENEX_INLINE static constexpr auto put(key_type &out, std::size_t &pos, Tup const &tup) noexcept -> void {
+            using elem_traits = radix_traits<std::remove_cvref_t<std::tuple_element_t<I, std::tuple<Ks...>>>>;
+            const auto elem = elem_traits::encode(std::get<I>(tup));
+            for (auto b = 0uz; b < elem_traits::width; ++b) {
+                out[pos++] = elem_traits::digit(elem, b);
+            }
+        }
+    };
+
+    template <typename... Ks>
+    struct radix_traits<std::tuple<Ks...>> : radix_composite_traits<std::tuple<Ks...>, Ks...> {
+    };
+
+    template <typename K1, typename K2>
+    struct radix_traits<std::pair<K1, K2>> : radix_composite_traits<std::pair<K1, K2>, K1, K2> {
+    };
+}
+
+namespace genex::actions::detail::concepts {
+    template <typename K>
+    concept radix_key =
+        requires { impl::radix_traits<std::remove_cvref_t<K>>::width; };
+
+    template <typename Rng, typename Proj>
+    concept can_radix_sort_range =
+        random_access_range<Rng> and
+        std::permutable<iterator_t<Rng>> and
+        std::indirectly_unary_invocable<Proj, iterator_t<Rng>> and
+        radix_key<std::indirect_result_t<Proj&, iterator_t<Rng>>>;
+}
+
+namespace genex::actions::detail::impl {
+    using radix_histogram = std::array<std::size_t, 256>;
+
+    // Below this size the thread start-up cost outweighs splitting the histogram and scatter.
+    inline constexpr std::size_t radix_parallel_threshold = 1 << 16;
+
+    template <typename Item, typename Digit>
+    auto lsd_histograms(Item const *data, const std::size_t n, const std::size_t width, Digit const &digit) -> std::vector<radix_histogram> {
+        auto hist = std::vector<radix_histogram>(width, radix_histogram{});
+        for (auto i = 0uz; i < n; ++i) {
+            for (auto d = 0uz; d < width; ++d) {
+                ++hist[d][digit(data[i], d)];
+            }
+        }
+        return hist;
+    }
+
+    GENEX_INLINE auto lsd_digit_is_uniform(radix_histogram const &hist, const std::size_t n) -> bool {
+        return std::ranges::any_of(hist, [n](const std::size_t c) { return c == n; });
+    }
+
+    /**
+     * Least-significant-digit byte radix sort of @c data, ping-ponging with @c buf. One pre-pass builds the histogram
+     * of every digit at once; digits where all keys share the same byte are skipped entirely (common for the high
+     * bytes of timestamps and IDs), and the result is moved back into @c data only if an odd number of scatters ran.
+     */
+    template <typename Item, typename Digit>
+    auto lsd_sort(Item *data, Item *buf, const std::size_t n, const std::size_t width, Digit const &digit) -> void {
+        const auto hist = lsd_histograms(data, n, width, digit);
+        auto *src = data;
+        auto *dst = buf;
+        for (auto d = 0uz; d < width; ++d) {
+            if (lsd_digit_is_uniform(hist[d], n)) { continue; }
+            auto offsets = radix_histogram{};
+            std::exclusive_scan(hist[d].begin(), hist[d].end(), offsets.begin(), 0uz);
+            for (auto i = 0uz; i < n; ++i) {
+                dst[offsets[digit(src[i], d)]++] = std::move(src[i]);
+            }
+            std::swap(src, dst);
+        }
+        if (src != data) {
+            std::move(src, src + n, data);
+        }
+    }
+
+    /**
+     * Parallel variant of @c lsd_sort: each thread histograms and then scatters its own contiguous chunk. Per-thread
+     * offsets are laid out bucket-major (all of thread 0's elements of a bucket before thread 1's), which keeps every
+     * pass stable and therefore the overall sort correct.
+     */
+    template <typename Item, typename Digit>
+    auto lsd_sort_parallel(Item *data, Item *buf, const std::size_t n, const std::size_t width, Digit const &digit) -> void {
+        const auto threads = std::max(1u, std::thread::hardware_concurrency());
+        const auto chunk = (n + threads - 1) / threads;
+        const auto chunk_bounds = [&](const std::size_t t) { return std::pair{std::min(n, t * chunk), std::min(n, (t + 1) * chunk)}; };
+
+        auto run = [&](auto &&body) {
+            auto workers = std::vector<std::jthread>();
+            workers.reserve(threads);
+            for (auto t = 0uz; t < threads; ++t) { workers.emplace_back(body, t); }
+        };
+
+        auto local = std::vector<std::vector<radix_histogram>>(threads);
+        run([&](const std::size_t t) {
+            auto [lo, hi] = chunk_bounds(t);
+            local[t] = lsd_histograms(data + lo, hi - lo, width, digit);
+        });
+        auto uniform = std::vector<bool>(width);
+        for (auto d = 0uz; d < width; ++d) {
+            auto total = radix_histogram{};
+            for (auto const &h : local) {
+                std::transform(total.begin(), total.end(), h[d].begin(), total.begin(), std::plus{});
+            }
+            uniform[d] = lsd_digit_is_uniform(total, n);
+        }
+
+        auto *src = data;
+        auto *dst = buf;
+        auto counts = std::vector<radix_histogram>(threads);
+        for (auto d = 0uz; d < width; ++d) {
+            if (uniform[d]) { continue; }
+            run([&](const std::size_t t) {
+                auto [lo, hi] = chunk_bounds(t);
+                counts[t].fill(0);
+                for (auto i = lo; i < hi; ++i) { ++counts[t][digit(src[i], d)]; }
+            });
+            auto running = 0uz;
+            for (auto b = 0uz; b < 256; ++b) {
+                for (auto t = 0uz; t < threads; ++t) {
+                    running += std::exchange(counts[t][b], running);
+                }
+            }
+            run([&](const std::size_t t) {
+                auto [lo, hi] = chunk_bounds(t);
+                auto &offsets = counts[t];
+                for (auto i = lo; i < hi; ++i) { dst[offsets[digit(src[i], d)]++] = std::move(src[i]); }
+            });
+            std::swap(src, dst);
+        }
+        if (src != data) {
+            std::move(src, src + n, data);
+        }
+    }
+
+    template <typename Item, typename Digit>
+    GENEX_INLINE auto lsd_dispatch(Item *data, Item *buf, const std::size_t n, const std::size_t width, Digit const &digit, const bool parallel) -> void {
+        if (parallel and n >= radix_parallel_threshold) { lsd_sort_parallel(data, buf, n, width, digit); }
+        else { lsd_sort(data, buf, n, width, digit); }
+    }
+
+    template <typename I, typename S, typename Proj>
+    auto do_radix_sort(I first, S last, Proj &&proj, const bool parallel) -> void {
+        using key_t = std::remove_cvref_t<std::indirect_result_t<Proj&, I>>;
+        using traits = radix_traits<key_t>;
+        using value_t = iter_value_t<I>;
+
+        const auto n = static_cast<std::size_t>(last - first);
+        if (n < 2) { return; }
+
+        if constexpr (std::contiguous_iterator<I> and std::same_as<std::remove_cvref_t<Proj>, meta::identity> and std::same_as<key_t, value_t> and std::is_arithmetic_v<value_t>) {
+            // Plain numbers sort in place: re-encoding a scalar per digit is cheaper than carrying a key array.
+            auto buf = std::vector<value_t>(n);
+            auto digit = [](const value_t x, const std::size_t d) { return traits::digit(traits::encode(x), d); };
+            lsd_dispatch(std::to_address(first), buf.data(), n, traits::width, digit, parallel);
+        }
+        else {
+            // Sort (encoded key, index) pairs so each projection runs once and elements move once, at the end.
+            using item_t = std::pair<typename traits::key_type, std::size_t>;
+            auto items = std::vector<item_t>();
+            items.reserve(n);
+            for (auto i = 0uz; i < n; ++i) {
+                items.emplace_back(traits::encode(meta::invoke(proj, first[i])), i);
+            }
+            auto buf = std::vector<item_t>(n);
+            auto digit = [](item_t const &item, const std::size_t d) { return traits::digit(item.first, d); };
+            lsd_dispatch(items.data(), buf.data(), n, traits::width, digit, parallel);
+
+            auto sorted = std::vector<value_t>();
+            sorted.reserve(n);
+            for (auto const &item : items) { sorted.emplace_back(std::move(first[item.second])); }
+            std::move(sorted.begin(), sorted.end(), first);
+        }
+    }
+}
+
+namespace genex::actions {
+    struct radix_sort_fn {
+        template <typename Rng, typename Proj = meta::identity>
+        requires detail::concepts::can_radix_sort_range<Rng, Proj>
+        GENEX_INLINE auto operator()(Rng &&rng, Proj proj = {}) const -> decltype(auto) {
+            auto [first, last] = iterators::iter_pair(rng);
+            detail::impl::do_radix_sort(std::move(first), std::move(last), proj, false);
+            return std::forward<Rng>(rng);
+        }
+
+        template <typename Rng, typename Proj>
+        requires detail::concepts::can_radix_sort_range<Rng, Proj>
+        GENEX_INLINE auto operator()(Rng &&rng, Proj proj, std::execution::parallel_policy const &) const -> decltype(auto) {
+            auto [first, last] = iterators::iter_pair(rng);
+            detail::impl::do_radix_sort(std::move(first), std::move(last), proj, true);
+            return std::forward<Rng>(rng);
+        }
+
+        template <typename Proj = meta::identity>
+        requires (not range<Proj> and not std::is_execution_policy_v<Proj>)
+        GENEX_INLINE constexpr auto operator()(Proj proj = {}) const {
+            return meta::bind_back(radix_sort_fn{}, std::move(proj));
+        }
+
+        template <typename Proj>
+        requires (not range<Proj>)
+        GENEX_INLINE constexpr auto operator()(Proj proj, std::execution::parallel_policy const &policy) const {
+            return meta::bind_back(radix_sort_fn{}, std::move(proj), policy);
+        }
+
+        GENEX_INLINE constexpr auto operator()(std::execution::parallel_policy const &policy) const {
+            return meta::bind_back(radix_sort_fn{}, meta::identity{}, policy);
+        }
+    };
+
+    export inline constexpr radix_sort_fn radix_sort{};
+}
@@ -16,17 +16,105 @@ namespace genex::actions::detail::concepts {
         std::sortable<iterator_t<Rng>, Comp, Proj>;
 }
 
+namespace genex::actions::detail::impl {
+    template <typename Rng>
+    struct static_extent : std::integral_constant<std::size_t, std::dynamic_extent> {
+    };
+
+    template <typename T, std::size_t N>
+    struct static_extent<std::array<T, N>> : std::integral_constant<std::size_t, N> {
+    };
+
+    template <typename T, std::size_t N>
+    struct static_extent<T[N]> : std::integral_constant<std::size_t, N> {
+    };
+
+    template <typename T, std::size_t N>
+    struct static_extent<std::span<T, N>> : std::integral_constant<std::size_t, N> {
+    };
+
+    template <typename Rng>
+    inline constexpr std::size_t static_extent_v = static_extent<std::remove_cvref_t<Rng>>::value;
+
+    // Ranges with a compile-time extent up to this size are sorted with an unrolled sorting network.
+    inline constexpr std::size_t sorting_network_max = 32;
+
+    /**
+     * Batcher's odd-even merge network for @c N inputs, emitted as (i, j) compare-exchange pairs with i < j. It matches
+     * the optimal comparator count for N <= 8 and stays within a few percent of the best known networks up to 32,
+     * with no data-dependent control flow.
+     */
+    template <std::size_t N, typename F>
+    constexpr auto generate_sorting_network(F &&emit) -> void {
+        for (auto p = 1uz; p < N; p <<= 1) {
+            for (auto k = p; k >= 1; k >>= 1) {
+                for (auto j = k % p; j + k < N; j += 2 * k) {
+                    for (auto i = 0uz; i < std::min(k, N - j - k); ++i) {
+                        if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) { emit(i + j, i + j + k); }
+                    }
+                }
+            }
+        }
+    }
+
+    template <std::size_t N>
+    constexpr auto sorting_network_size() -> std::size_t {
+        auto n = 0uz;
+        generate_sorting_network<N>([&n](std::size_t, std::size_t) { ++n; });
+        return n;
+    }
+
+    template <std::size_t N>
+    inline constexpr auto sorting_network = [] {
+        auto out = std::array<std::pair<std::uint8_t, std::uint8_t>, sorting_network_size<N>()>{};
+        auto n = 0uz;
+        generate_sorting_network<N>([&](const std::size_t i, const std::size_t j) {
+            out[n++] = {static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(j)};
+        });
+        return out;
+    }();
+
+    template <typename T, typename Comp, typename Proj>
+    GENEX_INLINE constexpr auto compare_exchange(T &lhs, T &rhs, Comp &comp, Proj &proj) -> void {
+        const bool swap = meta::invoke(comp, meta::invoke(proj, rhs), meta::invoke(proj, lhs));
+        if constexpr (std::is_trivially_copyable_v<T> and sizeof(T) <= 2 * sizeof(void*)) {
+            // Select-then-store rather than a conditional swap, so small values compile to conditional moves.
+            const auto lo = swap ? rhs : lhs;
+            const auto hi = swap ? lhs : rhs;
+            lhs = lo;
+            rhs = hi;
+        }
+        else if (swap) {
+            std::ranges::swap(lhs, rhs);
+        }
+    }
+
+    template <std::size_t N, typename I, typename Comp, typename Proj>
+    GENEX_INLINE constexpr auto network_sort(I first, Comp &comp, Proj &proj) -> void {
+        [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+            (compare_exchange(first[sorting_network<N>[Ks].first], first[sorting_network<N>[Ks].second], comp, proj), ...);
+        }(std::make_index_sequence<sorting_network<N>.size()>{});
+    }
+}
+
 namespace genex::actions {
     struct sort_fn {
         template <typename Rng, typename Comp = operations::lt, typename Proj = meta::identity>
         requires detail::concepts::can_sort_range<Rng, Comp, Proj>
         GENEX_INLINE constexpr auto operator()(Rng &&rng, Comp comp = {}, Proj proj = {}) const -> decltype(auto) {
             auto [first, last] = iterators::iter_pair(rng);
-            auto sorter = [&]<typename Lhs, typename Rhs>(Lhs &&lhs, Rhs &&rhs) {
-                return meta::invoke(comp, meta::invoke(proj, std::forward<Lhs>(lhs)), meta::invoke(proj, std::forward<Rhs>(rhs)));
-            };
-            std::sort(std::move(first), std::move(last), std::move(sorter));
-            return std::forward<Rng>(rng);
+            constexpr auto extent = detail::impl::static_extent_v<Rng>;
+            if constexpr (extent != std::dynamic_extent and extent <= detail::impl::sorting_network_max) {
+                if constexpr (extent > 1) { detail::impl::network_sort<extent>(std::move(first), comp, proj); }
+                return std::forward<Rng>(rng);
+            }
+            else {
+                auto sorter = [&]<typename Lhs, typename Rhs>(Lhs &&lhs, Rhs &&rhs) {
+                    return meta::invoke(comp, meta::invoke(proj, std::forward<Lhs>(lhs)), meta::invoke(proj, std::forward<Rhs>(rhs)));
+                };
+                std::sort(std::move(first), std::move(last), std::move(sorter));
+                return std::forward<Rng>(rng);
+            }
         }
 
         template <typename Comp = operations::lt, typename Proj = meta::identity>
@@ -0,0 +1,99 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.actions.sort_by_cached_key;
+export import genex.pipe;
+import genex.concepts;
+import genex.iterators.iter_pair;
+import genex.meta;
+import genex.operations.cmp;
+import std;
+
+namespace genex::actions::detail::concepts {
+    template <typename I, typename S, typename Proj, typename Comp>
+    concept can_sort_by_cached_key_iters =
+        std::random_access_iterator<I> and
+        std::sized_sentinel_for<S, I> and
+        std::permutable<I> and
+        std::indirectly_regular_unary_invocable<Proj, I> and
+        std::movable<std::remove_cvref_t<std::indirect_result_t<Proj&, I>>> and
+        std::strict_weak_order<Comp&, std::remove_cvref_t<std::indirect_result_t<Proj&, I>> const&, std::remove_cvref_t<std::indirect_result_t<Proj&, I>> const&>;
+
+    template <typename Rng, typename Proj, typename Comp>
+    concept can_sort_by_cached_key_range =
+        random_access_range<Rng> and
+        can_sort_by_cached_key_iters<iterator_t<Rng>, sentinel_t<Rng>, Proj, Comp>;
+}
+
+namespace genex::actions::detail::impl {
+    /**
+     * Reorders @c [first, first + perm.size()) so that position @c i receives the element previously at @c perm[i],
+     * following each cycle of the permutation so every element is moved exactly once (plus one temporary per cycle).
+     * @c perm is consumed: visited entries are overwritten with their own index to mark them as placed.
+     */
+    template <typename I>
+    auto apply_permutation(I first, std::span<std::size_t> perm) -> void {
+        for (auto start = 0uz; start < perm.size(); ++start) {
+            if (perm[start] == start) { continue; }
+            auto tmp = iter_value_t<I>(std::ranges::iter_move(first + start));
+            auto pos = start;
+            while (perm[pos] != start) {
+                const auto src = perm[pos];
+                first[pos] = std::ranges::iter_move(first + src);
+                perm[pos] = pos;
+                pos = src;
+            }
+            first[pos] = std::move(tmp);
+            perm[pos] = pos;
+        }
+    }
+
+    /**
+     * Computes each key once, sorts the (key, index) pairs, then permutes the elements in place. Ties are broken by
+     * the original index, so the result is stable; the projection runs exactly n times instead of ~2n log n.
+     */
+    template <typename I, typename S, typename Proj, typename Comp>
+    requires concepts::can_sort_by_cached_key_iters<I, S, Proj, Comp>
+    auto do_sort_by_cached_key(I first, S last, Proj &proj, Comp &comp) -> void {
+        using key_t = std::remove_cvref_t<std::indirect_result_t<Proj&, I>>;
+
+        const auto n = static_cast<std::size_t>(last - first);
+        if (n < 2) { return; }
+
+        auto keyed = std::vector<std::pair<key_t, std::size_t>>();
+        keyed.reserve(n);
+        for (auto i = 0uz; i < n; ++i) {
+            keyed.emplace_back(meta::invoke(proj, first[i]), i);
+        }
+        std::sort(keyed.begin(), keyed.end(), [&comp](auto const &lhs, auto const &rhs) {
+            if (meta::invoke(comp, lhs.first, rhs.first)) { return true; }
+            if (meta::invoke(comp, rhs.first, lhs.first)) { return false; }
+            return lhs.second < rhs.second;
+        });
+
+        auto perm = std::vector<std::size_t>(n);
+        std::ranges::transform(keyed, perm.begin(), [](auto const &pair) { return pair.second; });
+        keyed = {};
+        apply_permutation(std::move(first), std::span(perm));
+    }
+}
+
+namespace genex::actions {
+    struct sort_by_cached_key_fn {
+        template <typename Rng, typename Proj, typename Comp = operations::lt>
+        requires detail::concepts::can_sort_by_cached_key_range<Rng, Proj, Comp>
+        GENEX_INLINE auto operator()(Rng &&rng, Proj proj, Comp comp = {}) const -> decltype(auto) {
+            auto [first, last] = iterators::iter_pair(rng);
+            detail::impl::do_sort_by_cached_key(std::move(first), std::move(last), proj, comp);
+            return std::forward<Rng>(rng);
+        }
+
+        template <typename Proj, typename Comp = operations::lt>
+        requires (not range<Proj>)
+        GENEX_INLINE constexpr auto operator()(Proj proj, Comp comp = {}) const {
+            return meta::bind_back(sort_by_cached_key_fn{}, std::move(proj), std::move(comp));
+        }
+    };
+
+    export inline constexpr sort_by_cached_key_fn sort_by_cached_key{};
+}
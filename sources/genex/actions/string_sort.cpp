@@ -0,0 +1,184 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.actions.string_sort;
+export import genex.pipe;
+import genex.concepts;
+import genex.iterators.iter_pair;
+import genex.meta;
+import std;
+
+namespace genex::actions::detail::impl {
+    template <typename K>
+    struct string_key_traits {
+    };
+
+    template <typename K>
+    requires requires { typename K::value_type; } and std::convertible_to<K const&, std::basic_string_view<typename K::value_type>>
+    struct string_key_traits<K> {
+        using char_type = typename K::value_type;
+    };
+
+    template <std::integral C>
+    struct string_key_traits<C*> {
+        using char_type = std::remove_const_t<C>;
+    };
+}
+
+namespace genex::actions::detail::concepts {
+    template <typename K>
+    concept string_key =
+        requires { typename impl::string_key_traits<std::remove_cvref_t<K>>::char_type; };
+
+    template <typename Rng, typename Proj>
+    concept can_string_sort_range =
+        random_access_range<Rng> and
+        std::permutable<iterator_t<Rng>> and
+        std::indirectly_unary_invocable<Proj, iterator_t<Rng>> and
+        string_key<std::indirect_result_t<Proj&, iterator_t<Rng>>>;
+}
+
+namespace genex::actions::detail::impl {
+    // Buckets this small are finished with insertion sort on the remaining suffixes.
+    inline constexpr std::size_t string_sort_insertion_threshold = 16;
+
+    template <typename C>
+    struct string_sort_item {
+        std::basic_string_view<C> key;
+        std::size_t idx;
+        std::uint64_t word = 0;
+    };
+
+    /**
+     * Multikey quicksort (Bentley & Sedgewick) over a "superalphabet": instead of one character per level, the next
+     * 8 bytes of each key from depth @c d are packed big-endian into a cached 64-bit word, so each partitioning pass
+     * is a single integer comparison per key and common prefixes are consumed 8 bytes at a time. Keys never get
+     * re-compared from their start, which is where comparison sorts lose their time on URL- and path-like data.
+     */
+    template <typename C>
+    struct multikey_quicksort {
+        using item_t = string_sort_item<C>;
+        using uchar_t = std::make_unsigned_t<C>;
+        static constexpr std::size_t chars_per_word = sizeof(std::uint64_t) / sizeof(C);
+
+        GENEX_INLINE static auto load_word(std::basic_string_view<C> key, const std::size_t d) noexcept -> std::uint64_t {
+            // Missing characters pad with zero; ties with real zeros are resolved by length in `finish_equal`.
+            auto word = std::uint64_t{0};
+            for (auto i = 0uz; i < chars_per_word; ++i) {
+                const auto c = d + i < key.size() ? static_cast<uchar_t>(key[d + i]) : uchar_t{0};
+                word = (word << (8 * sizeof(C))) | c;
+            }
+            return word;
+        }
+
+        GENEX_INLINE static auto suffix_less(item_t const &lhs, item_t const &rhs, const std::size_t d) noexcept -> bool {
+            return lhs.key.substr(std::min(d, lhs.key.size())) < rhs.key.substr(std::min(d, rhs.key.size()));
+        }
+
+        static auto insertion_sort(item_t *a, const std::size_t n, const std::size_t d) -> void {
+            for (auto i = 1uz; i < n; ++i) {
+                auto tmp = std::move(a[i]);
+                auto j = i;
+                for (; j > 0 and suffix_less(tmp, a[j - 1], d); --j) {
+                    a[j] = std::move(a[j - 1]);
+                }
+                a[j] = std::move(tmp);
+            }
+        }
+
+        GENEX_INLINE static auto median_word(item_t const *a, const std::size_t n) noexcept -> std::uint64_t {
+            const auto x = a[0].word;
+            const auto y = a[n / 2].word;
+            const auto z = a[n - 1].word;
+            return std::max(std::min(x, y), std::min(std::max(x, y), z));
+        }
+
+        static auto sort(item_t *a, std::size_t n, std::size_t d, bool cached) -> void {
+            while (n > string_sort_insertion_threshold) {
+                if (not cached) {
+                    for (auto i = 0uz; i < n; ++i) { a[i].word = load_word(a[i].key, d); }
+                }
+
+                // Three-way partition on the cached words: [0, lt) < pivot, [lt, gt) == pivot, [gt, n) > pivot.
+                const auto pivot = median_word(a, n);
+                auto lt = 0uz;
+                auto i = 0uz;
+                auto gt = n;
+                while (i < gt) {
+                    if (a[i].word < pivot) { std::swap(a[lt++], a[i++]); }
+                    else if (a[i].word > pivot) { std::swap(a[i], a[--gt]); }
+                    else { ++i; }
+                }
+                sort(a, lt, d, true);
+                sort(a + gt, n - gt, d, true);
+
+                // Keys that end within this word are ordered among themselves by length, and precede the rest.
+                auto *eq = a + lt;
+                const auto eq_n = gt - lt;
+                auto *rest = std::partition(eq, eq + eq_n, [d](item_t const &item) { return item.key.size() <= d + chars_per_word; });
+                std::sort(eq, rest, [](item_t const &lhs, item_t const &rhs) { return lhs.key.size() < rhs.key.size(); });
+                a = rest;
+                n = static_cast<std::size_t>(eq + eq_n - rest);
+                d += chars_per_word;
+                cached = false;
+            }
+            insertion_sort(a, n, d);
+        }
+    };
+
+    template <typename I, typename S, typename Proj>
+    auto do_string_sort(I first, S last, Proj &&proj) -> void {
+        using key_ref_t = std::indirect_result_t<Proj&, I>;
+        using key_t = std::remove_cvref_t<key_ref_t>;
+        using char_t = typename string_key_traits<key_t>::char_type;
+        using item_t = string_sort_item<char_t>;
+
+        const auto n = static_cast<std::size_t>(last - first);
+        if (n < 2) { return; }
+
+        auto items = std::vector<item_t>();
+        items.reserve(n);
+
+        // Projections returning references or views are borrowed; owning temporaries (e.g. a lowered copy) are kept
+        // alive in `owned` for the duration of the sort.
+        constexpr auto borrowed = std::is_lvalue_reference_v<key_ref_t> or std::is_trivially_copyable_v<key_t>;
+        auto owned = std::vector<std::conditional_t<borrowed, std::monostate, key_t>>();
+        if constexpr (borrowed) {
+            for (auto i = 0uz; i < n; ++i) {
+                items.push_back({std::basic_string_view<char_t>(meta::invoke(proj, first[i])), i});
+            }
+        }
+        else {
+            owned.reserve(n);
+            for (auto i = 0uz; i < n; ++i) { owned.emplace_back(meta::invoke(proj, first[i])); }
+            for (auto i = 0uz; i < n; ++i) { items.push_back({std::basic_string_view<char_t>(owned[i]), i}); }
+        }
+
+        multikey_quicksort<char_t>::sort(items.data(), n, 0, false);
+
+        auto sorted = std::vector<iter_value_t<I>>();
+        sorted.reserve(n);
+        for (auto const &item : items) { sorted.emplace_back(std::move(first[item.idx])); }
+        std::move(sorted.begin(), sorted.end(), first);
+    }
+}
+
+namespace genex::actions {
+    struct string_sort_fn {
+        template <typename Rng, typename Proj = meta::identity>
+        requires detail::concepts::can_string_sort_range<Rng, Proj>
+        GENEX_INLINE auto operator()(Rng &&rng, Proj proj = {}) const -> decltype(auto) {
+            auto [first, last] = iterators::iter_pair(rng);
+            detail::impl::do_string_sort(std::move(first), std::move(last), proj);
+            return std::forward<Rng>(rng);
+        }
+
+        template <typename Proj = meta::identity>
+        requires (not range<Proj>)
+        GENEX_INLINE constexpr auto operator()(Proj proj = {}) const {
+            return meta::bind_back(string_sort_fn{}, std::move(proj));
+        }
+    };
+
+    export inline constexpr string_sort_fn string_sort{};
+}
@@ -2,6 +2,7 @@ module;
 #include <genex/macros.hpp>
 
 export module genex.algorithms.binary_search;
+import genex.algorithms.search_primitives;
 import genex.concepts;
 import genex.meta;
 import genex.iterators.iter_pair;
@@ -25,9 +26,7 @@ namespace genex::algorithms::detail::impl {
     template <typename I, typename S, typename E, typename Comp, typename Proj>
     requires concepts::binary_searchable_iters<I, S, E, Comp, Proj>
     GENEX_INLINE constexpr auto do_binary_search(I first, S last, E &&elem, Comp &&comp, Proj &&proj) -> bool {
-        first = std::lower_bound(std::move(first), std::move(last), elem, [&]<typename T, typename U>(T &&a, U &&b) {
-            return meta::invoke(comp, meta::invoke(proj, std::forward<T>(a)), std::forward<U>(b));
-        });
+        first = do_lower_bound(std::move(first), last, elem, comp, proj);
         return first != last and not meta::invoke(comp, meta::invoke(proj, *first), std::forward<E>(elem));
     }
 }
@@ -0,0 +1,71 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.bounds;
+import genex.algorithms.search_primitives;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::algorithms::detail::impl {
+    template <typename I, typename S, typename E, typename Comp, typename Proj>
+    requires concepts::bound_searchable_iters<I, S, E, Comp, Proj>
+    GENEX_INLINE constexpr auto do_equal_range(I first, S last, E const &elem, Comp &comp, Proj &proj) -> std::pair<I, I> {
+        auto lo = do_lower_bound(std::move(first), last, elem, comp, proj);
+        auto hi = do_upper_bound(lo, std::move(last), elem, comp, proj);
+        return {std::move(lo), std::move(hi)};
+    }
+}
+
+namespace genex {
+    struct lower_bound_fn {
+        template <typename I, typename S, typename E, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::bound_searchable_iters<I, S, E, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(I first, S last, E &&elem, Comp &&comp = {}, Proj &&proj = {}) const -> I {
+            return algorithms::detail::impl::do_lower_bound(std::move(first), std::move(last), elem, comp, proj);
+        }
+
+        template <typename Rng, typename E, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::bound_searchable_range<Rng, E, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, E &&elem, Comp &&comp = {}, Proj &&proj = {}) const -> iterator_t<Rng> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_lower_bound(std::move(first), std::move(last), elem, comp, proj);
+        }
+    };
+
+    struct upper_bound_fn {
+        template <typename I, typename S, typename E, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::bound_searchable_iters<I, S, E, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(I first, S last, E &&elem, Comp &&comp = {}, Proj &&proj = {}) const -> I {
+            return algorithms::detail::impl::do_upper_bound(std::move(first), std::move(last), elem, comp, proj);
+        }
+
+        template <typename Rng, typename E, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::bound_searchable_range<Rng, E, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, E &&elem, Comp &&comp = {}, Proj &&proj = {}) const -> iterator_t<Rng> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_upper_bound(std::move(first), std::move(last), elem, comp, proj);
+        }
+    };
+
+    struct equal_range_fn {
+        template <typename I, typename S, typename E, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::bound_searchable_iters<I, S, E, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(I first, S last, E &&elem, Comp &&comp = {}, Proj &&proj = {}) const -> std::pair<I, I> {
+            return algorithms::detail::impl::do_equal_range(std::move(first), std::move(last), elem, comp, proj);
+        }
+
+        template <typename Rng, typename E, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::bound_searchable_range<Rng, E, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, E &&elem, Comp &&comp = {}, Proj &&proj = {}) const -> std::pair<iterator_t<Rng>, iterator_t<Rng>> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_equal_range(std::move(first), std::move(last), elem, comp, proj);
+        }
+    };
+
+    export inline constexpr lower_bound_fn lower_bound{};
+    export inline constexpr upper_bound_fn upper_bound{};
+    export inline constexpr equal_range_fn equal_range{};
+}
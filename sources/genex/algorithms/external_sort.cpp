@@ -0,0 +1,374 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.external_sort;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import genex.views2.merge;
+import std;
+
+namespace genex::algorithms::detail::concepts {
+    template <typename I, typename S, typename Comp, typename Proj>
+    concept externally_sortable_iters =
+        std::input_iterator<I> and
+        std::sentinel_for<S, I> and
+        std::is_trivially_copyable_v<iter_value_t<I>> and
+        std::indirect_strict_weak_order<Comp, std::projected<I, Proj>>;
+
+    template <typename Rng, typename Comp, typename Proj>
+    concept externally_sortable_range =
+        input_range<Rng> and
+        externally_sortable_iters<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj>;
+}
+
+namespace genex::algorithms::detail::impl {
+    // Run reads are kept at least this long whenever the budget allows, so merging reads the disk in long sequential
+    // blocks; runs beyond what the budget can buffer at this size are merged in extra passes instead.
+    inline constexpr std::size_t external_sort_min_read_bytes = 1 << 16;
+
+    /**
+     * A uniquely named directory under the caller's temporary directory, holding the spilled runs of one sort. It and
+     * everything in it is removed when the owning range is destroyed.
+     */
+    struct external_sort_workspace {
+        std::filesystem::path dir;
+
+        explicit external_sort_workspace(std::filesystem::path const &parent) {
+            auto rd = std::random_device();
+            for (auto attempt = 0; attempt < 16; ++attempt) {
+                const auto tag = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+                auto candidate = parent / std::format("genex-external-sort-{:016x}", tag);
+                if (std::filesystem::create_directory(candidate)) {
+                    dir = std::move(candidate);
+                    return;
+                }
+            }
+            throw std::runtime_error("genex::external_sort: could not create a temporary directory");
+        }
+
+        external_sort_workspace(external_sort_workspace &&that) noexcept :
+            dir(std::exchange(that.dir, {})) {
+        }
+
+        external_sort_workspace(external_sort_workspace const &) = delete;
+        auto operator=(external_sort_workspace const &) -> external_sort_workspace& = delete;
+        auto operator=(external_sort_workspace &&) -> external_sort_workspace& = delete;
+
+        ~external_sort_workspace() {
+            if (dir.empty()) { return; }
+            auto ec = std::error_code();
+            std::filesystem::remove_all(dir, ec);
+        }
+
+        GENEX_NODISCARD auto run_path(const std::size_t idx) const -> std::filesystem::path {
+            return dir / std::format("run-{}.bin", idx);
+        }
+    };
+
+    /**
+     * Appends blocks of elements to a new run file. @c close reports any buffered write that failed; a writer
+     * destroyed without being closed (because an exception is propagating) closes the file silently.
+     */
+    template <typename T>
+    struct external_run_writer {
+        std::filesystem::path path;
+        std::FILE *file;
+
+        explicit external_run_writer(std::filesystem::path p) :
+            path(std::move(p)), file(std::fopen(path.c_str(), "wb")) {
+            if (file == nullptr) { throw std::runtime_error("genex::external_sort: could not create run file " + path.string()); }
+        }
+
+        external_run_writer(external_run_writer const &) = delete;
+        auto operator=(external_run_writer const &) -> external_run_writer& = delete;
+
+        ~external_run_writer() {
+            if (file != nullptr) { std::fclose(file); }
+        }
+
+        auto write(std::span<const T> data) -> void {
+            if (std::fwrite(data.data(), sizeof(T), data.size(), file) != data.size()) {
+                throw std::runtime_error("genex::external_sort: could not write run file " + path.string());
+            }
+        }
+
+        auto close() -> void {
+            const auto closed = std::fclose(std::exchange(file, nullptr)) == 0;
+            if (not closed) { throw std::runtime_error("genex::external_sort: could not write run file " + path.string()); }
+        }
+    };
+
+    template <typename T>
+    auto write_run(std::filesystem::path const &path, std::span<const T> data) -> void {
+        auto writer = external_run_writer<T>(path);
+        writer.write(data);
+        writer.close();
+    }
+
+    template <typename T>
+    struct external_run;
+
+    struct external_run_sentinel {};
+
+    template <typename T>
+    struct external_run_iterator {
+        external_run<T> *run = nullptr;
+
+        using value_type = T;
+        using reference_type = T const&;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(external_run_iterator)
+
+        GENEX_INLINE constexpr external_run_iterator() = default;
+
+        GENEX_INLINE constexpr explicit external_run_iterator(external_run<T> *run) :
+            run(run) {
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            self.run->advance();
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            return self.run->front[self.run->pos];
+        }
+
+        GENEX_VIEW_ITER_EQ(external_run_iterator, external_run_iterator) {
+            return self.run == that.run;
+        }
+
+        GENEX_VIEW_ITER_EQ(external_run_iterator, external_run_sentinel) {
+            return self.run->pos == self.run->len;
+        }
+    };
+
+    /**
+     * One sorted run, read back through two buffers: while the merge consumes @c front, the next block of the file is
+     * read into @c back on another thread, so the disk and the merge overlap. A run that never had to be spilled
+     * (the whole input fit the budget) is held entirely in @c front with no file behind it.
+     */
+    template <typename T>
+    struct external_run {
+        std::FILE *file = nullptr;
+        std::vector<T> front;
+        std::vector<T> back;
+        std::future<std::size_t> pending;
+        std::size_t pos = 0;
+        std::size_t len = 0;
+
+        explicit external_run(std::vector<T> data) :
+            front(std::move(data)), len(front.size()) {
+        }
+
+        external_run(std::filesystem::path const &path, const std::size_t block) :
+            file(std::fopen(path.c_str(), "rb")), front(block), back(block) {
+            if (file == nullptr) { throw std::runtime_error("genex::external_sort: could not open run file " + path.string()); }
+            len = read_block(file, front.data(), front.size());
+            prefetch();
+        }
+
+        external_run(external_run &&that) noexcept :
+            file(std::exchange(that.file, nullptr)), front(std::move(that.front)), back(std::move(that.back)),
+            pending(std::move(that.pending)), pos(that.pos), len(that.len) {
+        }
+
+        external_run(external_run const &) = delete;
+        auto operator=(external_run const &) -> external_run& = delete;
+        auto operator=(external_run &&) -> external_run& = delete;
+
+        ~external_run() {
+            if (pending.valid()) { pending.wait(); }
+            if (file != nullptr) { std::fclose(file); }
+        }
+
+        GENEX_NODISCARD auto begin() -> external_run_iterator<T> {
+            return external_run_iterator<T>(this);
+        }
+
+        GENEX_NODISCARD auto end() noexcept -> external_run_sentinel {
+            return {};
+        }
+
+        auto advance() -> void {
+            if (++pos < len or file == nullptr) { return; }
+            len = pending.valid() ? pending.get() : 0;
+            pos = 0;
+            std::swap(front, back);
+            if (len != 0) { prefetch(); }
+        }
+
+    private:
+        static auto read_block(std::FILE *file, T *data, const std::size_t count) -> std::size_t {
+            const auto n = std::fread(data, sizeof(T), count, file);
+            if (n < count and std::ferror(file)) { throw std::runtime_error("genex::external_sort: could not read run file"); }
+            return n;
+        }
+
+        auto prefetch() -> void {
+            // The task only touches the file and the heap block of `back`, both of which survive moving the run.
+            pending = std::async(std::launch::async, [file = file, data = back.data(), count = back.size()] {
+                return read_block(file, data, count);
+            });
+        }
+    };
+
+    /**
+     * The lazily merged output of @c external_sort. It owns the spill directory and the open runs, and is move-only;
+     * iterating it streams the merge once.
+     */
+    template <typename T, typename Comp, typename Proj>
+    struct external_sorted_view {
+        using merged_type = decltype(views::merge_all(std::declval<std::vector<external_run<T>>&>(), std::declval<Comp>(), std::declval<Proj>()));
+
+        external_sort_workspace workspace;
+        std::vector<external_run<T>> runs;
+        merged_type merged;
+
+        external_sorted_view(external_sort_workspace workspace, std::vector<external_run<T>> runs, Comp comp, Proj proj) :
+            workspace(std::move(workspace)), runs(std::move(runs)), merged(views::merge_all(this->runs, std::move(comp), std::move(proj))) {
+        }
+
+        GENEX_NODISCARD auto begin() -> auto {
+            return merged.begin();
+        }
+
+        GENEX_NODISCARD auto end() -> auto {
+            return merged.end();
+        }
+    };
+
+    /**
+     * The largest number of runs one merge may read at once within @c memory_budget: two buffers per run of at least
+     * @c external_sort_min_read_bytes each when the budget allows, and never fewer than two runs.
+     */
+    GENEX_INLINE constexpr auto external_sort_fan_in(const std::size_t memory_budget) noexcept -> std::size_t {
+        return std::max<std::size_t>(2, memory_budget / (2 * external_sort_min_read_bytes));
+    }
+
+    // The elements per read buffer when the budget is shared by `buffers` equal buffers.
+    template <typename T>
+    GENEX_INLINE constexpr auto external_sort_block(const std::size_t memory_budget, const std::size_t buffers) noexcept -> std::size_t {
+        return std::max<std::size_t>(1, memory_budget / (buffers * sizeof(T)));
+    }
+
+    /**
+     * Merges the runs in @c ids into one new run, through two read buffers per input and one write buffer that share
+     * the budget, and deletes the inputs.
+     */
+    template <typename T, typename Comp, typename Proj>
+    auto merge_runs(external_sort_workspace const &workspace, std::span<const std::size_t> ids, const std::size_t out_id, const std::size_t memory_budget, Comp const &comp, Proj const &proj) -> void {
+        const auto block = external_sort_block<T>(memory_budget, 2 * ids.size() + 1);
+        {
+            auto group = std::vector<external_run<T>>();
+            group.reserve(ids.size());
+            for (const auto id : ids) { group.emplace_back(workspace.run_path(id), block); }
+
+            auto writer = external_run_writer<T>(workspace.run_path(out_id));
+            auto out = std::vector<T>();
+            out.reserve(block);
+            for (auto const &x : views::merge_all(group, comp, proj)) {
+                out.push_back(x);
+                if (out.size() == block) {
+                    writer.write(out);
+                    out.clear();
+                }
+            }
+            writer.write(out);
+            writer.close();
+        }
+        for (const auto id : ids) { std::filesystem::remove(workspace.run_path(id)); }
+    }
+
+    /**
+     * Cuts the input into runs of @c memory_budget bytes, sorts each in memory and writes it out with a single
+     * sequential write, then hands the runs to a k-way merge. Every run being merged holds two read buffers, and the
+     * budget is split evenly across them, so the budget bounds the merge's fan-in: if there are more runs than
+     * @c external_sort_fan_in allows, groups of that many are first merged into longer runs on disk, pass after pass,
+     * until few enough remain for the final, lazy merge.
+     */
+    template <typename I, typename S, typename Comp, typename Proj>
+    requires concepts::externally_sortable_iters<I, S, Comp, Proj>
+    auto do_external_sort(I first, S last, const std::size_t memory_budget, std::filesystem::path const &tmp_dir, Comp comp, Proj proj) -> external_sorted_view<iter_value_t<I>, Comp, Proj> {
+        using value_t = iter_value_t<I>;
+        auto workspace = external_sort_workspace(tmp_dir);
+        auto runs = std::vector<external_run<value_t>>();
+
+        const auto chunk_cap = std::max<std::size_t>(1, memory_budget / sizeof(value_t));
+        auto chunk = std::vector<value_t>();
+        chunk.reserve(chunk_cap);
+        auto run_count = 0uz;
+        auto sort_chunk = [&] {
+            std::sort(chunk.begin(), chunk.end(), [&comp, &proj](value_t const &lhs, value_t const &rhs) {
+                return meta::invoke(comp, meta::invoke(proj, lhs), meta::invoke(proj, rhs));
+            });
+        };
+
+        while (true) {
+            for (; first != last and chunk.size() < chunk_cap; ++first) { chunk.emplace_back(*first); }
+            sort_chunk();
+            if (first == last and run_count == 0) {
+                runs.emplace_back(std::move(chunk));
+                return external_sorted_view<value_t, Comp, Proj>(std::move(workspace), std::move(runs), std::move(comp), std::move(proj));
+            }
+            write_run(workspace.run_path(run_count++), std::span<const value_t>(chunk));
+            chunk.clear();
+            if (first == last) { break; }
+        }
+        chunk = {};
+
+        const auto fan_in = external_sort_fan_in(memory_budget);
+        auto live = std::vector<std::size_t>(run_count);
+        std::iota(live.begin(), live.end(), 0uz);
+        while (live.size() > fan_in) {
+            auto next = std::vector<std::size_t>();
+            for (auto i = 0uz; i < live.size(); i += fan_in) {
+                const auto group = std::span<const std::size_t>(live).subspan(i, std::min(fan_in, live.size() - i));
+                if (group.size() == 1) {
+                    next.push_back(group.front());
+                    continue;
+                }
+                merge_runs<value_t>(workspace, group, run_count, memory_budget, comp, proj);
+                next.push_back(run_count++);
+            }
+            live = std::move(next);
+        }
+
+        const auto block = external_sort_block<value_t>(memory_budget, 2 * live.size());
+        runs.reserve(live.size());
+        for (const auto id : live) { runs.emplace_back(workspace.run_path(id), block); }
+        return external_sorted_view<value_t, Comp, Proj>(std::move(workspace), std::move(runs), std::move(comp), std::move(proj));
+    }
+}
+
+namespace genex {
+    struct external_sort_fn {
+        /**
+         * Sorts a range that need not fit in memory, using at most about @c memory_budget bytes for element storage
+         * and @c tmp_dir for spilled runs. A small budget relative to the input costs extra merge passes over the
+         * disk rather than extra memory. The result is a move-only input range that merges the runs lazily; the
+         * temporary files are deleted when it is destroyed. Value types must be trivially copyable, as runs are
+         * written to disk byte for byte.
+         */
+        template <typename I, typename S, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::externally_sortable_iters<I, S, Comp, Proj>
+        auto operator()(I first, S last, const std::size_t memory_budget, std::filesystem::path const &tmp_dir, Comp comp = {}, Proj proj = {}) const {
+            return algorithms::detail::impl::do_external_sort(std::move(first), std::move(last), memory_budget, tmp_dir, std::move(comp), std::move(proj));
+        }
+
+        template <typename Rng, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::externally_sortable_range<Rng, Comp, Proj>
+        auto operator()(Rng &&rng, const std::size_t memory_budget, std::filesystem::path const &tmp_dir, Comp comp = {}, Proj proj = {}) const {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_external_sort(std::move(first), std::move(last), memory_budget, tmp_dir, std::move(comp), std::move(proj));
+        }
+    };
+
+    export inline constexpr external_sort_fn external_sort{};
+}
@@ -0,0 +1,147 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.eytzinger_index;
+import genex.algorithms.search_primitives;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.access;
+import genex.operations.cmp;
+import std;
+
+namespace genex {
+    /**
+     * A read-only search index over a sorted sequence of keys, stored in breadth-first (Eytzinger) order: the root
+     * at slot 1 and the children of slot @c k at @c 2k and @c 2k+1. The first few levels of the tree share a handful
+     * of cache lines that stay hot across searches, and the descendants of a slot four levels down (for 4-byte keys)
+     * are adjacent, so each step of a search can prefetch the line it will need several steps later. The descent is a
+     * single @c k=2k+(key[k]<x) per level with no data-dependent branch, which makes it faster than a binary search
+     * over the sorted array once the keys no longer fit in cache.
+     *
+     * Results are reported as positions in the original sorted sequence, so the index can sit alongside the range it
+     * was built from (e.g. a column of sorted IDs and the rows they belong to). It is also accepted as the probe side
+     * of @c views::in and @c views::not_in in place of a range.
+     * @tparam T The key type.
+     * @tparam Comp The strict weak order the source sequence is sorted by.
+     */
+    export template <typename T, typename Comp = operations::lt>
+    requires std::copyable<T>
+    class eytzinger_index {
+        // Slot 0 is never searched; it holds a copy of the smallest key so that the tree can start at slot 1.
+        std::vector<T> m_keys;
+        std::vector<std::size_t> m_ranks;
+        GENEX_NO_UNIQUE_ADDRESS Comp m_comp;
+
+        // Slots per cache line: the descendants of slot k four levels down start at slot 16k for 4-byte keys.
+        static constexpr std::size_t slots_per_line = std::max(64uz / sizeof(T), 1uz);
+
+    public:
+        using key_type = T;
+        using key_compare = Comp;
+        using size_type = std::size_t;
+
+        GENEX_INLINE eytzinger_index() = default;
+
+        /**
+         * Builds the index from a sequence sorted by @c comp. Duplicate keys are allowed; searches report the first
+         * of them.
+         */
+        template <typename I, typename S>
+        requires std::input_iterator<I> and std::sentinel_for<S, I> and std::constructible_from<T, iter_reference_t<I>>
+        GENEX_INLINE eytzinger_index(I first, S last, Comp comp = {}) :
+            m_comp(std::move(comp)) {
+            if constexpr (std::random_access_iterator<I> and std::sized_sentinel_for<S, I>) {
+                build(first, static_cast<std::size_t>(last - first));
+            }
+            else {
+                auto sorted = std::vector<T>();
+                for (; first != last; ++first) { sorted.emplace_back(*first); }
+                build(sorted.begin(), sorted.size());
+            }
+        }
+
+        template <typename Rng>
+        requires input_range<Rng> and std::constructible_from<T, range_reference_t<Rng>>
+        GENEX_INLINE explicit eytzinger_index(Rng &&rng, Comp comp = {}) :
+            eytzinger_index(iterators::begin(rng), iterators::end(rng), std::move(comp)) {
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto size(this Self &&self) noexcept -> std::size_t {
+            return self.m_ranks.empty() ? 0 : self.m_ranks.size() - 1;
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto empty(this Self &&self) noexcept -> bool {
+            return self.size() == 0;
+        }
+
+        /**
+         * The position in the source sequence of the first key not ordered before @c key, or @c size() if there is
+         * none.
+         */
+        template <typename K>
+        requires std::strict_weak_order<Comp const&, T const&, K const&>
+        GENEX_NODISCARD GENEX_INLINE auto lower_bound(K const &key) const -> std::size_t {
+            const auto slot = descend(key);
+            return slot == 0 ? size() : m_ranks[slot];
+        }
+
+        /**
+         * The position in the source sequence of the first key equivalent to @c key, or @c size() if there is none.
+         */
+        template <typename K>
+        requires std::strict_weak_order<Comp const&, T const&, K const&>
+        GENEX_NODISCARD GENEX_INLINE auto find(K const &key) const -> std::size_t {
+            const auto slot = descend(key);
+            return slot != 0 and not meta::invoke(m_comp, key, m_keys[slot]) ? m_ranks[slot] : size();
+        }
+
+        template <typename K>
+        requires std::strict_weak_order<Comp const&, T const&, K const&>
+        GENEX_NODISCARD GENEX_INLINE auto contains(K const &key) const -> bool {
+            const auto slot = descend(key);
+            return slot != 0 and not meta::invoke(m_comp, key, m_keys[slot]);
+        }
+
+    private:
+        template <typename I>
+        auto build(I sorted, const std::size_t n) -> void {
+            if (n == 0) { return; }
+            m_keys.assign(n + 1, T(sorted[0]));
+            m_ranks.assign(n + 1, 0);
+
+            // Visit the slots in order (leftmost leaf first, then successor by successor) and hand each the next key.
+            auto k = 1uz;
+            while (2 * k <= n) { k *= 2; }
+            for (auto i = 0uz; i < n; ++i) {
+                m_keys[k] = T(sorted[static_cast<std::ptrdiff_t>(i)]);
+                m_ranks[k] = i;
+                if (2 * k + 1 <= n) {
+                    k = 2 * k + 1;
+                    while (2 * k <= n) { k *= 2; }
+                }
+                else {
+                    k >>= std::countr_one(k) + 1;
+                }
+            }
+        }
+
+        /**
+         * Descends to a leaf, going right past every key ordered before @c key. The path taken is recorded in the bits
+         * of @c k; the answer is the last slot where the descent went left, found by dropping the trailing right turns
+         * and the left turn before them. Returns 0 when every key is ordered before @c key.
+         */
+        template <typename K>
+        GENEX_INLINE auto descend(K const &key) const -> std::size_t {
+            const auto n = size();
+            const auto *keys = m_keys.data();
+            auto k = 1uz;
+            while (k <= n) {
+                algorithms::detail::impl::prefetch(keys + std::min(k * slots_per_line, n));
+                k = 2 * k + static_cast<std::size_t>(meta::invoke(m_comp, keys[k], key));
+            }
+            return k >> (std::countr_one(k) + 1);
+        }
+    };
+}
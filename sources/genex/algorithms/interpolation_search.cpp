@@ -0,0 +1,87 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.interpolation_search;
+import genex.algorithms.search_primitives;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import std;
+
+namespace genex::algorithms::detail::concepts {
+    template <typename I, typename S, typename E, typename Proj>
+    concept interpolation_searchable_iters =
+        std::random_access_iterator<I> and
+        std::sized_sentinel_for<S, I> and
+        std::indirectly_regular_unary_invocable<Proj, I> and
+        std::is_arithmetic_v<std::remove_cvref_t<std::indirect_result_t<Proj&, I>>> and
+        std::is_arithmetic_v<std::remove_cvref_t<E>>;
+
+    template <typename Rng, typename E, typename Proj>
+    concept interpolation_searchable_range =
+        random_access_range<Rng> and
+        interpolation_searchable_iters<iterator_t<Rng>, sentinel_t<Rng>, E, Proj>;
+}
+
+namespace genex::algorithms::detail::impl {
+    // Below this many candidates, the branchless binary search finishes faster than further interpolation.
+    inline constexpr std::ptrdiff_t interpolation_search_cutoff = 32;
+
+    /**
+     * Guesses the position of @c elem from the values at the ends of the remaining range, assuming the keys are
+     * roughly uniformly spread, and narrows the range to one side of the guess. On uniform data this takes
+     * O(log log n) probes. The number of guesses is capped at twice that, after which (or once the range is small) a
+     * branchless binary search finishes, so skewed data degrades to O(log n) rather than O(n).
+     */
+    template <typename I, typename S, typename E, typename Proj>
+    requires concepts::interpolation_searchable_iters<I, S, E, Proj>
+    GENEX_INLINE constexpr auto do_interpolation_search(I first, S last, E const &elem, Proj &proj) -> I {
+        auto key = [&](const std::ptrdiff_t i) { return meta::invoke(proj, first[i]); };
+        auto lt = numeric_lt{};
+        const auto target = static_cast<long double>(elem);
+
+        auto lo = std::ptrdiff_t{0};
+        auto hi = static_cast<std::ptrdiff_t>(last - first);
+        auto budget = 2 * std::bit_width(std::bit_width(static_cast<std::size_t>(hi))) + 2;
+        while (hi - lo > interpolation_search_cutoff and budget-- > 0) {
+            const auto k_lo = key(lo);
+            const auto k_hi = key(hi - 1);
+            if (not lt(k_lo, elem)) { return first + lo; }
+            if (lt(k_hi, elem)) { return first + hi; }
+
+            // k_lo < elem <= k_hi here, so the span is positive and the guess lands in (lo, hi - 1].
+            const auto span = static_cast<long double>(k_hi) - static_cast<long double>(k_lo);
+            const auto frac = (target - static_cast<long double>(k_lo)) / span;
+            if (not std::isfinite(frac)) { break; }  // Infinite keys give no usable spread; bisect the rest.
+            const auto pos = std::clamp(lo + static_cast<std::ptrdiff_t>(frac * static_cast<long double>(hi - 1 - lo)), lo + 1, hi - 1);
+            if (lt(key(pos), elem)) { lo = pos + 1; }
+            else { hi = pos; }
+        }
+
+        return do_lower_bound(first + lo, first + hi, elem, lt, proj);
+    }
+}
+
+namespace genex {
+    struct interpolation_search_fn {
+        /**
+         * @c lower_bound for sorted ranges of numeric keys in ascending order, which probes where the key should be
+         * rather than at the midpoint. Worthwhile for large, roughly uniformly distributed keys (timestamps, hashes,
+         * sequential IDs); on skewed data it is never much worse than @c lower_bound.
+         */
+        template <typename I, typename S, typename E, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::interpolation_searchable_iters<I, S, E, Proj>
+        GENEX_INLINE constexpr auto operator()(I first, S last, E &&elem, Proj &&proj = {}) const -> I {
+            return algorithms::detail::impl::do_interpolation_search(std::move(first), std::move(last), elem, proj);
+        }
+
+        template <typename Rng, typename E, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::interpolation_searchable_range<Rng, E, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, E &&elem, Proj &&proj = {}) const -> iterator_t<Rng> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_interpolation_search(std::move(first), std::move(last), elem, proj);
+        }
+    };
+
+    export inline constexpr interpolation_search_fn interpolation_search{};
+}
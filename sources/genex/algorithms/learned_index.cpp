@@ -0,0 +1,202 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.learned_index;
+import genex.algorithms.search_primitives;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.access;
+import genex.iterators.iter_pair;
+import std;
+
+namespace genex::algorithms::detail::concepts {
+    template <typename I, typename S, typename T, typename Proj>
+    concept learned_indexable_iters =
+        std::random_access_iterator<I> and
+        std::sized_sentinel_for<S, I> and
+        std::indirectly_regular_unary_invocable<Proj, I> and
+        std::convertible_to<std::indirect_result_t<Proj&, I>, T>;
+
+    template <typename Rng, typename T, typename Proj>
+    concept learned_indexable_range =
+        random_access_range<Rng> and
+        learned_indexable_iters<iterator_t<Rng>, sentinel_t<Rng>, T, Proj>;
+}
+
+namespace genex {
+    /**
+     * A learned search index over a large, sorted (ascending) sequence of numeric keys, such as timestamps or file
+     * offsets. Instead of the keys themselves it stores a piecewise-linear model of where each key sits: a list of
+     * segments, each predicting positions to within @c Epsilon of the truth for the keys it covers. Smooth data needs
+     * very few segments (tens to low thousands for 100M keys), so the model stays in cache; a lookup is a search over
+     * the segments, one multiply-add, and a branchless search of the @c 2*Epsilon+2 positions around the prediction,
+     * which is typically the only cache miss.
+     *
+     * The index does not own the keys: @c lower_bound and @c contains take the same range the index was built from,
+     * mirroring @c genex::lower_bound and @c genex::binary_search. Long runs of duplicate keys can push a query past
+     * the error bound, in which case the search falls back to a binary search of the rest of the range.
+     * @tparam T The arithmetic key type.
+     * @tparam Epsilon The maximum error of a predicted position, trading lookup work against the number of segments.
+     */
+    export template <typename T, std::size_t Epsilon = 64>
+    requires std::is_arithmetic_v<T>
+    class learned_index {
+        struct segment {
+            T key;
+            double slope;
+            std::size_t pos;
+        };
+
+        std::vector<segment> m_segments;
+        std::size_t m_size = 0;
+
+    public:
+        using key_type = T;
+        using size_type = std::size_t;
+
+        static constexpr std::size_t epsilon = Epsilon;
+
+        GENEX_INLINE learned_index() = default;
+
+        /**
+         * Fits the model to the (projected) keys of a sorted range in one pass.
+         */
+        template <typename I, typename S, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::learned_indexable_iters<I, S, T, Proj>
+        GENEX_INLINE learned_index(I first, S last, Proj proj = {}) {
+            build(std::move(first), static_cast<std::size_t>(last - first), proj);
+        }
+
+        template <typename Rng, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::learned_indexable_range<Rng, T, Proj>
+        GENEX_INLINE explicit learned_index(Rng &&rng, Proj proj = {}) :
+            learned_index(iterators::begin(rng), iterators::end(rng), std::move(proj)) {
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto size(this Self &&self) noexcept -> std::size_t {
+            return self.m_size;
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto empty(this Self &&self) noexcept -> bool {
+            return self.m_size == 0;
+        }
+
+        /**
+         * The number of linear segments in the model; the index occupies roughly this many times 24 bytes.
+         */
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto segment_count(this Self &&self) noexcept -> std::size_t {
+            return self.m_segments.size();
+        }
+
+        /**
+         * The first position in @c [first, last) whose key is not less than @c elem. @c [first, last) must be the
+         * sequence the index was built from.
+         */
+        template <typename I, typename S, typename E, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::learned_indexable_iters<I, S, T, Proj> and std::is_arithmetic_v<std::remove_cvref_t<E>>
+        GENEX_NODISCARD GENEX_INLINE auto lower_bound(I first, S last, E const &elem, Proj proj = {}) const -> I {
+            GENEX_ASSERT(std::invalid_argument, static_cast<std::size_t>(last - first) == m_size);
+            return first + static_cast<std::ptrdiff_t>(search(first, elem, proj));
+        }
+
+        template <typename Rng, typename E, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::learned_indexable_range<Rng, T, Proj> and std::is_arithmetic_v<std::remove_cvref_t<E>>
+        GENEX_NODISCARD GENEX_INLINE auto lower_bound(Rng &&rng, E const &elem, Proj proj = {}) const -> iterator_t<Rng> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return lower_bound(std::move(first), std::move(last), elem, std::move(proj));
+        }
+
+        template <typename I, typename S, typename E, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::learned_indexable_iters<I, S, T, Proj> and std::is_arithmetic_v<std::remove_cvref_t<E>>
+        GENEX_NODISCARD GENEX_INLINE auto contains(I first, S last, E const &elem, Proj proj = {}) const -> bool {
+            const auto it = lower_bound(first, last, elem, proj);
+            return it != last and not algorithms::detail::impl::numeric_lt{}(elem, meta::invoke(proj, *it));
+        }
+
+        template <typename Rng, typename E, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::learned_indexable_range<Rng, T, Proj> and std::is_arithmetic_v<std::remove_cvref_t<E>>
+        GENEX_NODISCARD GENEX_INLINE auto contains(Rng &&rng, E const &elem, Proj proj = {}) const -> bool {
+            auto [first, last] = iterators::iter_pair(rng);
+            return contains(std::move(first), std::move(last), elem, std::move(proj));
+        }
+
+    private:
+        /**
+         * Greedy "shrinking cone" segmentation: a segment starts at a key and keeps the range of slopes that predict
+         * every later key to within @c Epsilon; once a key would empty that range, the segment is closed with the
+         * middle slope and a new one starts at that key. Only the first of each run of equal keys is fitted, since
+         * that is the position @c lower_bound reports.
+         */
+        template <typename I, typename Proj>
+        auto build(I first, const std::size_t n, Proj &proj) -> void {
+            m_size = n;
+            if (n == 0) { return; }
+
+            constexpr auto eps = static_cast<long double>(Epsilon);
+            constexpr auto unbounded = std::numeric_limits<long double>::infinity();
+            auto key = [&](const std::size_t i) -> T { return meta::invoke(proj, first[static_cast<std::ptrdiff_t>(i)]); };
+
+            auto x0 = key(0);
+            auto y0 = 0uz;
+            auto lo = 0.0l;
+            auto hi = unbounded;
+            auto prev = x0;
+            for (auto i = 1uz; i < n; ++i) {
+                const auto x = key(i);
+                GENEX_ASSERT(std::invalid_argument, not (x < prev));
+                if (not (prev < x)) { continue; }
+                prev = x;
+
+                const auto dx = static_cast<long double>(x) - static_cast<long double>(x0);
+                const auto dy = static_cast<long double>(i - y0);
+                const auto new_lo = std::max(lo, (dy - eps) / dx);
+                const auto new_hi = std::min(hi, (dy + eps) / dx);
+                if (new_lo > new_hi) {
+                    m_segments.push_back({x0, static_cast<double>(hi == unbounded ? lo : (lo + hi) / 2), y0});
+                    x0 = x;
+                    y0 = i;
+                    lo = 0.0l;
+                    hi = unbounded;
+                }
+                else {
+                    lo = new_lo;
+                    hi = new_hi;
+                }
+            }
+            m_segments.push_back({x0, static_cast<double>(hi == unbounded ? lo : (lo + hi) / 2), y0});
+            m_segments.shrink_to_fit();
+        }
+
+        template <typename I, typename E, typename Proj>
+        auto search(I first, E const &elem, Proj &proj) const -> std::size_t {
+            if (m_size == 0) { return 0; }
+
+            // The segment covering elem is the last one starting at or before it. Keys and queries are compared by
+            // value, so a negative query against unsigned keys lands before the first key rather than wrapping.
+            auto lt = algorithms::detail::impl::numeric_lt{};
+            auto seg_key = &segment::key;
+            const auto seg = algorithms::detail::impl::do_upper_bound(m_segments.begin(), m_segments.end(), elem, lt, seg_key);
+            if (seg == m_segments.begin()) { return 0; }
+            const auto &s = *std::prev(seg);
+            const auto next = seg == m_segments.end() ? m_size : seg->pos;
+
+            const auto guess = static_cast<long double>(s.pos) + s.slope * (static_cast<long double>(elem) - static_cast<long double>(s.key));
+            const auto pos = static_cast<std::size_t>(std::clamp(guess, static_cast<long double>(s.pos), static_cast<long double>(next)));
+            const auto lo = pos > Epsilon + 1 ? pos - (Epsilon + 1) : 0uz;
+            const auto hi = std::min(pos + Epsilon + 2, m_size);
+
+            auto at = [&](const std::size_t i) { return first + static_cast<std::ptrdiff_t>(i); };
+            auto found = static_cast<std::size_t>(algorithms::detail::impl::do_lower_bound(at(lo), at(hi), elem, lt, proj) - first);
+            if (found == hi and hi < m_size) {
+                found = static_cast<std::size_t>(algorithms::detail::impl::do_lower_bound(at(hi), at(m_size), elem, lt, proj) - first);
+            }
+            else if (found == lo and lo > 0 and not lt(meta::invoke(proj, *at(lo - 1)), elem)) {
+                found = static_cast<std::size_t>(algorithms::detail::impl::do_lower_bound(first, at(lo), elem, lt, proj) - first);
+            }
+            return found;
+        }
+    };
+}
@@ -0,0 +1,159 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.lower_bound_many;
+import genex.algorithms.search_primitives;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::algorithms::detail::concepts {
+    template <typename I, typename S, typename QI, typename QS, typename Comp, typename Proj>
+    concept lower_bound_manyable_iters =
+        std::random_access_iterator<I> and
+        std::sized_sentinel_for<S, I> and
+        std::forward_iterator<QI> and
+        std::sentinel_for<QS, QI> and
+        std::indirect_strict_weak_order<Comp, std::projected<I, Proj>, QI>;
+
+    template <typename Rng, typename Queries, typename Comp, typename Proj>
+    concept lower_bound_manyable_range =
+        random_access_range<Rng> and
+        forward_range<Queries> and
+        lower_bound_manyable_iters<iterator_t<Rng>, sentinel_t<Rng>, iterator_t<Queries>, sentinel_t<Queries>, Comp, Proj>;
+}
+
+namespace genex::algorithms::detail::impl {
+    // Searches kept in flight at once; enough to cover memory latency without spilling the per-lane state.
+    inline constexpr std::size_t lower_bound_many_lanes = 16;
+
+    /**
+     * Answers sorted queries with one forward pass: each search starts where the previous one ended and gallops
+     * (1, 2, 4, ... ahead) before bisecting, so the total cost is O(m log(n / m)) and degrades gracefully to a plain
+     * merge when the queries are dense.
+     */
+    template <typename I, typename QI, typename QS, typename Comp, typename Proj, typename F>
+    auto scan_sorted_queries(I first, const std::ptrdiff_t n, QI q_first, QS q_last, Comp &comp, Proj &proj, F &&emit) -> void {
+        auto pos = std::ptrdiff_t{0};
+        for (; q_first != q_last; ++q_first) {
+            decltype(auto) q = *q_first;
+            auto below = [&]<typename T>(T &&x) { return meta::invoke(comp, meta::invoke(proj, std::forward<T>(x)), q); };
+            if (pos < n and below(first[pos])) {
+                auto lo = pos;
+                auto step = std::ptrdiff_t{1};
+                while (lo + step < n and below(first[lo + step])) {
+                    lo += step;
+                    step *= 2;
+                }
+                pos = partition_point_branchless(first + (lo + 1), first + std::min(lo + step, n), below) - first;
+            }
+            emit(static_cast<std::size_t>(pos));
+        }
+    }
+
+    /**
+     * Runs @c lower_bound_many_lanes branchless searches in lockstep. Every search over the same array shrinks the
+     * same length at the same rate, so the lanes share one loop counter and differ only in their base offsets; the
+     * next probes of all lanes are prefetched before any is compared, so their cache misses overlap instead of
+     * queueing one behind another.
+     */
+    template <typename I, typename QI, typename QS, typename Comp, typename Proj, typename F>
+    auto search_interleaved(I first, const std::ptrdiff_t n, QI q_first, QS q_last, Comp &comp, Proj &proj, F &&emit) -> void {
+        constexpr auto lanes = lower_bound_many_lanes;
+        auto queries = std::array<QI, lanes>();
+        auto bases = std::array<std::ptrdiff_t, lanes>();
+
+        while (q_first != q_last) {
+            auto count = 0uz;
+            for (; count < lanes and q_first != q_last; ++count, ++q_first) { queries[count] = q_first; }
+            auto below = [&](const std::size_t lane, const std::ptrdiff_t idx) {
+                return meta::invoke(comp, meta::invoke(proj, first[idx]), *queries[lane]);
+            };
+
+            bases.fill(0);
+            if (n == 0) {
+                for (auto lane = 0uz; lane < count; ++lane) { emit(0uz); }
+                continue;
+            }
+            for (auto len = n; len > 1;) {
+                const auto half = len / 2;
+                for (auto lane = 0uz; lane < count; ++lane) {
+                    prefetch(first + (bases[lane] + half / 2));
+                    prefetch(first + (bases[lane] + half + half / 2));
+                }
+                for (auto lane = 0uz; lane < count; ++lane) {
+                    bases[lane] += below(lane, bases[lane] + half) ? half : 0;
+                }
+                len -= half;
+            }
+            for (auto lane = 0uz; lane < count; ++lane) {
+                emit(static_cast<std::size_t>(bases[lane] + (below(lane, bases[lane]) ? 1 : 0)));
+            }
+        }
+    }
+
+    template <typename I, typename S, typename QI, typename QS, typename Comp, typename Proj, typename F>
+    auto do_lower_bound_many(I first, S last, QI q_first, QS q_last, Comp &comp, Proj &proj, F &&emit) -> void {
+        const auto n = static_cast<std::ptrdiff_t>(last - first);
+        if constexpr (std::indirect_strict_weak_order<Comp&, QI>) {
+            if (std::is_sorted(q_first, std::ranges::next(q_first, q_last), comp)) {
+                scan_sorted_queries(std::move(first), n, std::move(q_first), std::move(q_last), comp, proj, emit);
+                return;
+            }
+        }
+        search_interleaved(std::move(first), n, std::move(q_first), std::move(q_last), comp, proj, emit);
+    }
+}
+
+namespace genex {
+    struct lower_bound_many_fn {
+        /**
+         * Writes, for each query in order, the index of its @c lower_bound in the sorted range to @c out, and returns
+         * the advanced output iterator. Queries that are themselves sorted are answered in one galloping pass over
+         * the range; otherwise the searches are run several at a time so their cache misses overlap.
+         */
+        template <typename I, typename S, typename QI, typename QS, typename O, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::lower_bound_manyable_iters<I, S, QI, QS, Comp, Proj> and std::output_iterator<O, std::size_t>
+        auto operator()(I first, S last, QI q_first, QS q_last, O out, Comp comp = {}, Proj proj = {}) const -> O {
+            algorithms::detail::impl::do_lower_bound_many(std::move(first), std::move(last), std::move(q_first), std::move(q_last), comp, proj, [&out](const std::size_t idx) {
+                *out = idx;
+                ++out;
+            });
+            return out;
+        }
+
+        template <typename Rng, typename Queries, typename O, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::lower_bound_manyable_range<Rng, Queries, Comp, Proj> and std::output_iterator<O, std::size_t>
+        auto operator()(Rng &&rng, Queries &&queries, O out, Comp comp = {}, Proj proj = {}) const -> O {
+            auto [first, last] = iterators::iter_pair(rng);
+            auto [q_first, q_last] = iterators::iter_pair(queries);
+            return (*this)(std::move(first), std::move(last), std::move(q_first), std::move(q_last), std::move(out), std::move(comp), std::move(proj));
+        }
+    };
+
+    struct binary_search_many_fn {
+        /**
+         * Writes, for each query in order, whether it occurs in the sorted range to @c out, with the same batching as
+         * @c lower_bound_many.
+         */
+        template <typename Rng, typename Queries, typename O, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::lower_bound_manyable_range<Rng, Queries, Comp, Proj> and std::output_iterator<O, bool>
+        auto operator()(Rng &&rng, Queries &&queries, O out, Comp comp = {}, Proj proj = {}) const -> O {
+            auto [first, last] = iterators::iter_pair(rng);
+            auto [q_first, q_last] = iterators::iter_pair(queries);
+            const auto n = static_cast<std::size_t>(last - first);
+            auto q_it = q_first;
+            algorithms::detail::impl::do_lower_bound_many(first, last, std::move(q_first), std::move(q_last), comp, proj, [&](const std::size_t idx) {
+                *out = idx < n and not meta::invoke(comp, *q_it, meta::invoke(proj, first[idx]));
+                ++out;
+                ++q_it;
+            });
+            return out;
+        }
+    };
+
+    export inline constexpr lower_bound_many_fn lower_bound_many{};
+    export inline constexpr binary_search_many_fn binary_search_many{};
+}
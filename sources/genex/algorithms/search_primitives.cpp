@@ -0,0 +1,116 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.search_primitives;
+import genex.concepts;
+import genex.meta;
+import std;
+
+// Building blocks shared by the searching algorithms, views and containers. This module is internal: it is imported
+// directly by the modules that need it and is not re-exported, neither by them nor by the umbrella module.
+
+namespace genex::algorithms::detail::concepts {
+    export template <typename I, typename S, typename E, typename Comp, typename Proj>
+    concept bound_searchable_iters =
+        std::forward_iterator<I> and
+        std::sentinel_for<S, I> and
+        std::indirect_strict_weak_order<Comp, std::projected<I, Proj>, std::remove_cvref_t<E> const*>;
+
+    export template <typename Rng, typename E, typename Comp, typename Proj>
+    concept bound_searchable_range =
+        forward_range<Rng> and
+        bound_searchable_iters<iterator_t<Rng>, sentinel_t<Rng>, E, Comp, Proj>;
+}
+
+namespace genex::algorithms::detail::impl {
+    /**
+     * @c < over arithmetic values of possibly different types that compares the values themselves: a signed and an
+     * unsigned integer compare as with @c std::cmp_less, so a negative query sorts before every unsigned key instead
+     * of wrapping around to a huge one.
+     */
+    export struct numeric_lt {
+        template <typename A, typename B>
+        requires std::is_arithmetic_v<A> and std::is_arithmetic_v<B>
+        GENEX_INLINE constexpr auto operator()(const A a, const B b) const noexcept -> bool {
+            if constexpr (std::is_integral_v<A> and std::is_integral_v<B> and std::is_signed_v<A> != std::is_signed_v<B>) {
+                if constexpr (std::is_signed_v<A>) { return a < 0 or static_cast<std::make_unsigned_t<A>>(a) < b; }
+                else { return b > 0 and a < static_cast<std::make_unsigned_t<B>>(b); }
+            }
+            else {
+                return a < b;
+            }
+        }
+    };
+
+    export template <typename I>
+    GENEX_INLINE constexpr auto prefetch(I const &it) noexcept -> void {
+        if constexpr (std::contiguous_iterator<I>) {
+            if (not std::is_constant_evaluated()) { __builtin_prefetch(std::to_address(it)); }
+        }
+    }
+
+    /**
+     * The first position in @c [first, last) for which @c pred is false, given that @c pred partitions the range. On
+     * random-access inputs the search halves a length rather than a [lo, hi) pair, so the only decision per step is
+     * whether to move the base, which compiles to a conditional move instead of a hard-to-predict branch. Both
+     * positions the next step could probe are prefetched, so the memory access for step @c k+1 overlaps step @c k.
+     */
+    export template <typename I, typename S, typename Pred>
+    GENEX_INLINE constexpr auto partition_point_branchless(I first, S last, Pred &&pred) -> I {
+        if constexpr (std::random_access_iterator<I> and std::sized_sentinel_for<S, I>) {
+            auto n = last - first;
+            if (n == 0) { return first; }
+            while (n > 1) {
+                const auto half = n / 2;
+                prefetch(first + half / 2);
+                prefetch(first + (half + half / 2));
+                first += pred(first[half]) ? half : 0;
+                n -= half;
+            }
+            return first + (pred(*first) ? 1 : 0);
+        }
+        else {
+            auto end = std::ranges::next(first, std::move(last));
+            return std::partition_point(std::move(first), std::move(end), pred);
+        }
+    }
+
+    /**
+     * Advances @c it past the prefix of @c [it, st) satisfying @c pred, which must hold for @c *it. Random-access
+     * inputs are searched exponentially (1, 2, 4, ... elements ahead) and then by bisection, so skipping @c d elements
+     * costs O(log d) comparisons; this is what makes intersecting a short range with a long one O(k log n).
+     */
+    export template <typename I, typename S, typename Pred>
+    GENEX_INLINE constexpr auto gallop(I it, S st, Pred &&pred) -> I {
+        if constexpr (std::random_access_iterator<I> and std::sized_sentinel_for<S, I>) {
+            const auto n = st - it;
+            auto lo = iter_difference_t<I>{0};
+            auto step = iter_difference_t<I>{1};
+            while (step < n and pred(it[step])) {
+                lo = step;
+                step *= 2;
+            }
+            return std::partition_point(it + lo + 1, it + std::min(step, n), pred);
+        }
+        else {
+            for (++it; it != st and pred(*it); ++it) {}
+            return it;
+        }
+    }
+
+    export template <typename I, typename S, typename E, typename Comp, typename Proj>
+    requires concepts::bound_searchable_iters<I, S, E, Comp, Proj>
+    GENEX_INLINE constexpr auto do_lower_bound(I first, S last, E const &elem, Comp &comp, Proj &proj) -> I {
+        return partition_point_branchless(std::move(first), std::move(last), [&]<typename T>(T &&x) {
+            return meta::invoke(comp, meta::invoke(proj, std::forward<T>(x)), elem);
+        });
+    }
+
+    export template <typename I, typename S, typename E, typename Comp, typename Proj>
+    requires concepts::bound_searchable_iters<I, S, E, Comp, Proj>
+    GENEX_INLINE constexpr auto do_upper_bound(I first, S last, E const &elem, Comp &comp, Proj &proj) -> I {
+        return partition_point_branchless(std::move(first), std::move(last), [&]<typename T>(T &&x) {
+            return not meta::invoke(comp, elem, meta::invoke(proj, std::forward<T>(x)));
+        });
+    }
+}
@@ -3,6 +3,7 @@ module;
 
 export module genex.algorithms.sorted;
 import genex.concepts;
+import genex.memory;
 import genex.meta;
 import genex.iterators.iter_pair;
 import genex.operations.cmp;
@@ -22,10 +23,10 @@ namespace genex::algorithms::detail::concepts {
 }
 
 namespace genex::algorithms::detail::impl {
-    template <typename I, typename S, typename Comp, typename Proj>
+    template <typename I, typename S, typename Comp, typename Proj, typename Alloc = std::allocator<iter_value_t<I>>>
     requires concepts::sortabled_iters<I, S, Comp, Proj>
-    GENEX_INLINE constexpr auto do_sorted(I first, S last, Comp &&comp, Proj &&proj) -> std::vector<iter_value_t<I>> {
-        auto vec = std::vector<iter_value_t<I>>(std::make_move_iterator(first), std::make_move_iterator(last));
+    GENEX_INLINE constexpr auto do_sorted(I first, S last, Comp &&comp, Proj &&proj, Alloc const &alloc = {}) -> std::vector<iter_value_t<I>, Alloc> {
+        auto vec = std::vector<iter_value_t<I>, Alloc>(std::make_move_iterator(first), std::make_move_iterator(last), alloc);
         std::sort(vec.begin(), vec.end(), [comp, proj]<typename Lhs, typename Rhs>(Lhs &&lhs, Rhs &&rhs) {
             return meta::invoke(comp, meta::invoke(proj, std::forward<Lhs>(lhs)), meta::invoke(proj, std::forward<Rhs>(rhs)));
         });
@@ -47,6 +48,19 @@ namespace genex {
             auto [first, last] = iterators::iter_pair(rng);
             return algorithms::detail::impl::do_sorted(std::move(first), std::move(last), std::forward<Comp>(comp), std::forward<Proj>(proj));
         }
+
+        template <typename I, typename S, typename Comp = operations::lt, typename Proj = meta::identity, typename Alloc>
+        requires algorithms::detail::concepts::sortabled_iters<I, S, Comp, Proj> and allocator_or_resource<Alloc>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Comp &&comp, Proj &&proj, Alloc const &alloc) const -> std::vector<iter_value_t<I>, rebind_alloc_t<iter_value_t<I>, Alloc>> {
+            return algorithms::detail::impl::do_sorted(std::move(first), std::move(last), std::forward<Comp>(comp), std::forward<Proj>(proj), rebind_allocator<iter_value_t<I>>(alloc));
+        }
+
+        template <typename Rng, typename Comp = operations::lt, typename Proj = meta::identity, typename Alloc>
+        requires algorithms::detail::concepts::sortabled_range<Rng, Comp, Proj> and allocator_or_resource<Alloc>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Comp &&comp, Proj &&proj, Alloc const &alloc) const -> std::vector<range_value_t<Rng>, rebind_alloc_t<range_value_t<Rng>, Alloc>> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_sorted(std::move(first), std::move(last), std::forward<Comp>(comp), std::forward<Proj>(proj), rebind_allocator<range_value_t<Rng>>(alloc));
+        }
     };
 
     export inline constexpr sorted_fn sorted{};
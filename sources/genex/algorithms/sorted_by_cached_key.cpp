@@ -0,0 +1,55 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.sorted_by_cached_key;
+import genex.concepts;
+import genex.meta;
+import genex.actions.sort_by_cached_key;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::algorithms::detail::concepts {
+    template <typename I, typename S, typename Proj, typename Comp>
+    concept sortabled_by_cached_key_iters =
+        std::input_iterator<I> and
+        std::sentinel_for<S, I> and
+        std::movable<iter_value_t<I>> and
+        std::regular_invocable<Proj&, iter_value_t<I>&> and
+        std::strict_weak_order<Comp&, std::remove_cvref_t<std::invoke_result_t<Proj&, iter_value_t<I>&>> const&, std::remove_cvref_t<std::invoke_result_t<Proj&, iter_value_t<I>&>> const&>;
+
+    template <typename Rng, typename Proj, typename Comp>
+    concept sortabled_by_cached_key_range =
+        input_range<Rng> and
+        sortabled_by_cached_key_iters<iterator_t<Rng>, sentinel_t<Rng>, Proj, Comp>;
+}
+
+namespace genex::algorithms::detail::impl {
+    template <typename I, typename S, typename Proj, typename Comp>
+    requires concepts::sortabled_by_cached_key_iters<I, S, Proj, Comp>
+    GENEX_INLINE auto do_sorted_by_cached_key(I first, S last, Proj &&proj, Comp &&comp) -> std::vector<iter_value_t<I>> {
+        auto vec = std::vector<iter_value_t<I>>();
+        for (; first != last; ++first) { vec.emplace_back(std::ranges::iter_move(first)); }
+        actions::sort_by_cached_key(vec, std::forward<Proj>(proj), std::forward<Comp>(comp));
+        return vec;
+    }
+}
+
+namespace genex {
+    struct sorted_by_cached_key_fn {
+        template <typename I, typename S, typename Proj, typename Comp = operations::lt>
+        requires algorithms::detail::concepts::sortabled_by_cached_key_iters<I, S, Proj, Comp>
+        GENEX_INLINE auto operator()(I first, S last, Proj &&proj, Comp &&comp = {}) const -> std::vector<iter_value_t<I>> {
+            return algorithms::detail::impl::do_sorted_by_cached_key(std::move(first), std::move(last), std::forward<Proj>(proj), std::forward<Comp>(comp));
+        }
+
+        template <typename Rng, typename Proj, typename Comp = operations::lt>
+        requires algorithms::detail::concepts::sortabled_by_cached_key_range<Rng, Proj, Comp>
+        GENEX_INLINE auto operator()(Rng &&rng, Proj &&proj, Comp &&comp = {}) const -> std::vector<range_value_t<Rng>> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_sorted_by_cached_key(std::move(first), std::move(last), std::forward<Proj>(proj), std::forward<Comp>(comp));
+        }
+    };
+
+    export inline constexpr sorted_by_cached_key_fn sorted_by_cached_key{};
+}
@@ -0,0 +1,69 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.algorithms.sorted_indices;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::algorithms::detail::concepts {
+    template <typename I, typename S, typename Comp, typename Proj>
+    concept sortabled_indices_iters =
+        std::random_access_iterator<I> and
+        std::sized_sentinel_for<S, I> and
+        std::indirect_strict_weak_order<Comp, std::projected<I, Proj>>;
+
+    template <typename Rng, typename Comp, typename Proj>
+    concept sortabled_indices_range =
+        random_access_range<Rng> and
+        sortabled_indices_iters<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj>;
+}
+
+namespace genex::algorithms::detail::impl {
+    template <typename Index, typename I, typename S, typename Comp, typename Proj>
+    requires concepts::sortabled_indices_iters<I, S, Comp, Proj>
+    GENEX_INLINE auto do_sorted_indices(I first, S last, Comp &&comp, Proj &&proj) -> std::vector<Index> {
+        const auto n = static_cast<std::size_t>(last - first);
+        if (n != 0 and n - 1 > std::numeric_limits<Index>::max()) {
+            throw std::length_error("sorted_indices: range is too long for the index type");
+        }
+        auto indices = std::vector<Index>(n);
+        std::iota(indices.begin(), indices.end(), Index{0});
+        std::sort(indices.begin(), indices.end(), [&](const Index lhs, const Index rhs) {
+            return meta::invoke(comp, meta::invoke(proj, first[lhs]), meta::invoke(proj, first[rhs]));
+        });
+        return indices;
+    }
+}
+
+namespace genex {
+    /**
+     * Returns the permutation that sorts the range (an "argsort"): the element at sorted position @c i is
+     * @c rng[indices[i]]. Nothing is moved, so large records, or several parallel columns, can be ordered by one key
+     * and then read through @c views::permute. @c sorted_indices uses @c std::size_t indices; @c sorted_indices_as
+     * picks a narrower type (e.g. @c std::uint32_t) to halve the permutation's footprint.
+     * @tparam Index The index type of the returned permutation.
+     */
+    template <std::unsigned_integral Index>
+    struct sorted_indices_fn {
+        template <typename I, typename S, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::sortabled_indices_iters<I, S, Comp, Proj>
+        GENEX_INLINE auto operator()(I first, S last, Comp &&comp = {}, Proj &&proj = {}) const -> std::vector<Index> {
+            return algorithms::detail::impl::do_sorted_indices<Index>(std::move(first), std::move(last), std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+
+        template <typename Rng, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires algorithms::detail::concepts::sortabled_indices_range<Rng, Comp, Proj>
+        GENEX_INLINE auto operator()(Rng &&rng, Comp &&comp = {}, Proj &&proj = {}) const -> std::vector<Index> {
+            auto [first, last] = iterators::iter_pair(rng);
+            return algorithms::detail::impl::do_sorted_indices<Index>(std::move(first), std::move(last), std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+    };
+
+    export inline constexpr sorted_indices_fn<std::size_t> sorted_indices{};
+
+    export template <std::unsigned_integral Index>
+    inline constexpr sorted_indices_fn<Index> sorted_indices_as{};
+}
@@ -143,6 +143,15 @@ export namespace genex {
 
     template <typename Rng>
     concept sized_range = input_range<Rng> and std::sized_sentinel_for<sentinel_t<Rng>, iterator_t<Rng>>;
+
+    // The number of leading ranges in an argument pack, for variadic views taking ranges then a comparator etc.
+    template <typename... Args>
+    consteval auto leading_ranges() -> std::size_t {
+        constexpr bool is_range[] = {range<Args>..., false};
+        auto n = 0uz;
+        while (n < sizeof...(Args) and is_range[n]) { ++n; }
+        return n;
+    }
 }
 
 export namespace genex {
@@ -0,0 +1,212 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.containers.flat_map;
+import genex.containers.flat_set;
+import genex.concepts;
+import genex.operations.cmp;
+import std;
+
+namespace genex::containers::detail {
+    struct pair_key {
+        template <typename P>
+        GENEX_INLINE constexpr auto operator()(P &&p) const noexcept -> decltype(auto) {
+            return (std::forward<P>(p).first);
+        }
+    };
+
+    /**
+     * Mutable iterator over a @c flat_map. It walks the underlying vector but yields @c std::pair<K const&, V&>, so
+     * values can be assigned through it while the keys, which fix the element's position in the sort order, cannot.
+     */
+    template <typename K, typename V, typename I, typename CI>
+    struct flat_map_iterator {
+        I it;
+
+        using value_type = std::pair<K, V>;
+        using reference = std::pair<K const&, V&>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+
+        // operator-> has to return something that itself has operator->, as the pair of references is a temporary.
+        struct arrow_proxy {
+            reference ref;
+
+            GENEX_INLINE auto operator->() noexcept -> reference* {
+                return std::addressof(ref);
+            }
+        };
+
+        GENEX_INLINE constexpr flat_map_iterator() = default;
+
+        GENEX_INLINE constexpr explicit flat_map_iterator(I it) :
+            it(std::move(it)) {
+        }
+
+        GENEX_INLINE operator CI() const {
+            return it;
+        }
+
+        GENEX_INLINE auto operator*() const -> reference {
+            return {it->first, it->second};
+        }
+
+        GENEX_INLINE auto operator->() const -> arrow_proxy {
+            return {**this};
+        }
+
+        GENEX_INLINE auto operator[](const difference_type n) const -> reference {
+            return *(*this + n);
+        }
+
+        GENEX_INLINE auto operator++() -> flat_map_iterator& {
+            ++it;
+            return *this;
+        }
+
+        GENEX_INLINE auto operator++(int) -> flat_map_iterator {
+            auto temp = *this;
+            ++it;
+            return temp;
+        }
+
+        GENEX_INLINE auto operator--() -> flat_map_iterator& {
+            --it;
+            return *this;
+        }
+
+        GENEX_INLINE auto operator--(int) -> flat_map_iterator {
+            auto temp = *this;
+            --it;
+            return temp;
+        }
+
+        GENEX_INLINE auto operator+=(const difference_type n) -> flat_map_iterator& {
+            it += n;
+            return *this;
+        }
+
+        GENEX_INLINE auto operator-=(const difference_type n) -> flat_map_iterator& {
+            it -= n;
+            return *this;
+        }
+
+        GENEX_INLINE friend auto operator+(flat_map_iterator lhs, const difference_type n) -> flat_map_iterator {
+            return lhs += n;
+        }
+
+        GENEX_INLINE friend auto operator+(const difference_type n, flat_map_iterator rhs) -> flat_map_iterator {
+            return rhs += n;
+        }
+
+        GENEX_INLINE friend auto operator-(flat_map_iterator lhs, const difference_type n) -> flat_map_iterator {
+            return lhs -= n;
+        }
+
+        GENEX_INLINE friend auto operator-(flat_map_iterator const &lhs, flat_map_iterator const &rhs) -> difference_type {
+            return lhs.it - rhs.it;
+        }
+
+        GENEX_INLINE friend auto operator==(flat_map_iterator const &lhs, flat_map_iterator const &rhs) -> bool {
+            return lhs.it == rhs.it;
+        }
+
+        GENEX_INLINE friend auto operator<=>(flat_map_iterator const &lhs, flat_map_iterator const &rhs) -> std::strong_ordering {
+            return lhs.it <=> rhs.it;
+        }
+    };
+}
+
+namespace genex::containers {
+    /**
+     * An ordered map from unique keys to values, stored as one sorted vector of @c std::pair<K,V> in the manner of
+     * @c flat_set: contiguous iteration, one allocation, bulk construction and @c insert_range in a single sort and
+     * merge, and O(n) single inserts. The @c set_* members combine maps by key (or, given @c meta::identity as the
+     * projection, a map with a sorted range of keys). Mutable iterators yield @c std::pair<K const&, V&>, so values
+     * can be modified through them but keys cannot.
+     * @tparam K The key type.
+     * @tparam V The mapped type.
+     * @tparam Comp The strict weak order the keys are kept in.
+     * @tparam Alloc The allocator of the underlying vector.
+     */
+    export template <typename K, typename V, typename Comp = operations::lt, typename Alloc = std::allocator<std::pair<K, V>>>
+    requires std::strict_weak_order<Comp&, K const&, K const&>
+    class flat_map : public detail::flat_tree<std::pair<K, V>, detail::pair_key, Comp, Alloc> {
+        using base = detail::flat_tree<std::pair<K, V>, detail::pair_key, Comp, Alloc>;
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using reference = std::pair<K const&, V&>;
+        using iterator = detail::flat_map_iterator<K, V, typename base::storage_type::iterator, typename base::const_iterator>;
+
+        using base::base;
+        using base::begin;
+        using base::end;
+        using base::find;
+        using base::erase;
+
+        GENEX_NODISCARD GENEX_INLINE auto begin() noexcept -> iterator {
+            return iterator(this->m_data.begin());
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto end() noexcept -> iterator {
+            return iterator(this->m_data.end());
+        }
+
+        template <typename Key>
+        GENEX_NODISCARD GENEX_INLINE auto find(Key const &key) -> iterator {
+            const auto it = std::as_const(*this).find(key);
+            return iterator(this->m_data.begin() + (it - this->m_data.cbegin()));
+        }
+
+        GENEX_INLINE auto erase(iterator pos) -> iterator {
+            return iterator(this->m_data.erase(pos.it));
+        }
+
+        GENEX_INLINE auto insert(std::pair<K, V> const &value) -> std::pair<iterator, bool> {
+            auto [it, inserted] = this->emplace_unique(value.first, value);
+            return {iterator(it), inserted};
+        }
+
+        GENEX_INLINE auto insert(std::pair<K, V> &&value) -> std::pair<iterator, bool> {
+            auto [it, inserted] = this->emplace_unique(value.first, std::move(value));
+            return {iterator(it), inserted};
+        }
+
+        /**
+         * Constructs the value from @c args only if @c key is absent, leaving an existing entry untouched.
+         */
+        template <typename... Args>
+        requires std::constructible_from<V, Args&&...>
+        GENEX_INLINE auto try_emplace(K const &key, Args &&... args) -> std::pair<iterator, bool> {
+            auto [it, inserted] = this->emplace_unique(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            return {iterator(it), inserted};
+        }
+
+        template <typename M>
+        requires std::assignable_from<V&, M&&> and std::constructible_from<V, M&&>
+        GENEX_INLINE auto insert_or_assign(K const &key, M &&obj) -> std::pair<iterator, bool> {
+            auto [it, inserted] = this->emplace_unique(key, key, std::forward<M>(obj));
+            if (not inserted) { it->second = std::forward<M>(obj); }
+            return {iterator(it), inserted};
+        }
+
+        GENEX_INLINE auto operator[](K const &key) -> V& requires std::default_initializable<V> {
+            return try_emplace(key).first->second;
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto at(K const &key) -> V& {
+            const auto it = find(key);
+            if (it == end()) { throw std::out_of_range("flat_map::at: key not found"); }
+            return it->second;
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto at(K const &key) const -> V const& {
+            const auto it = find(key);
+            if (it == end()) { throw std::out_of_range("flat_map::at: key not found"); }
+            return it->second;
+        }
+    };
+}
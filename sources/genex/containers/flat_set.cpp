@@ -0,0 +1,285 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.containers.flat_set;
+import genex.algorithms.search_primitives;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.access;
+import genex.operations.cmp;
+import genex.views2.set_algorithms;
+import std;
+
+namespace genex::containers::detail {
+    /**
+     * The storage shared by @c flat_set and @c flat_map: a vector kept sorted by @c Comp over the key each element
+     * projects to through @c KeyProj, with no two elements having equivalent keys. Lookups are binary searches over
+     * contiguous memory, iteration is a pointer walk, and bulk insertion sorts the new elements and merges them in
+     * rather than inserting one at a time. Elements already present win over equivalent new ones, as with
+     * @c std::set::insert.
+     */
+    export template <typename T, typename KeyProj, typename Comp, typename Alloc>
+    class flat_tree {
+    protected:
+        using storage_type = std::vector<T, Alloc>;
+
+        storage_type m_data;
+        GENEX_NO_UNIQUE_ADDRESS Comp m_comp;
+        GENEX_NO_UNIQUE_ADDRESS KeyProj m_key;
+
+    public:
+        using value_type = T;
+        using key_compare = Comp;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_reference = T const&;
+        using const_iterator = typename storage_type::const_iterator;
+
+        GENEX_INLINE flat_tree() = default;
+
+        GENEX_INLINE explicit flat_tree(Comp comp, Alloc const &alloc = Alloc()) :
+            m_data(alloc), m_comp(std::move(comp)) {
+        }
+
+        /**
+         * Builds from any range of elements, sorted or not. Input that is already sorted is detected in one pass and
+         * costs O(n); otherwise it is sorted first. Later duplicates of a key are dropped.
+         */
+        template <typename I, typename S>
+        requires std::input_iterator<I> and std::sentinel_for<S, I> and std::constructible_from<T, iter_reference_t<I>>
+        GENEX_INLINE flat_tree(I first, S last, Comp comp = {}, Alloc const &alloc = Alloc()) :
+            m_data(alloc), m_comp(std::move(comp)) {
+            insert_range(std::move(first), std::move(last));
+        }
+
+        GENEX_INLINE flat_tree(std::initializer_list<T> il, Comp comp = {}, Alloc const &alloc = Alloc()) :
+            flat_tree(il.begin(), il.end(), std::move(comp), alloc) {
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto size() const noexcept -> std::size_t {
+            return m_data.size();
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto empty() const noexcept -> bool {
+            return m_data.empty();
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto capacity() const noexcept -> std::size_t {
+            return m_data.capacity();
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto data() const noexcept -> T const* {
+            return m_data.data();
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto begin() const noexcept -> const_iterator {
+            return m_data.cbegin();
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto end() const noexcept -> const_iterator {
+            return m_data.cend();
+        }
+
+        GENEX_INLINE auto reserve(const std::size_t new_cap) -> void {
+            m_data.reserve(new_cap);
+        }
+
+        GENEX_INLINE auto clear() noexcept -> void {
+            m_data.clear();
+        }
+
+        template <typename K>
+        GENEX_NODISCARD GENEX_INLINE auto lower_bound(K const &key) const -> const_iterator {
+            auto comp = m_comp;
+            auto proj = m_key;
+            return algorithms::detail::impl::do_lower_bound(m_data.cbegin(), m_data.cend(), key, comp, proj);
+        }
+
+        template <typename K>
+        GENEX_NODISCARD GENEX_INLINE auto upper_bound(K const &key) const -> const_iterator {
+            auto comp = m_comp;
+            auto proj = m_key;
+            return algorithms::detail::impl::do_upper_bound(m_data.cbegin(), m_data.cend(), key, comp, proj);
+        }
+
+        template <typename K>
+        GENEX_NODISCARD GENEX_INLINE auto find(K const &key) const -> const_iterator {
+            const auto it = lower_bound(key);
+            return it != m_data.cend() and not holds_before(key, *it) ? it : m_data.cend();
+        }
+
+        template <typename K>
+        GENEX_NODISCARD GENEX_INLINE auto contains(K const &key) const -> bool {
+            return find(key) != m_data.cend();
+        }
+
+        template <typename K>
+        GENEX_NODISCARD GENEX_INLINE auto count(K const &key) const -> std::size_t {
+            return contains(key) ? 1 : 0;
+        }
+
+        /**
+         * Adds every element of a range with one sort of the new elements (skipped if they are already sorted) and
+         * one linear merge with the existing ones, i.e. O(n + m log m) rather than O(m n) for @c m single inserts.
+         * The new elements are sorted in a separate buffer and every comparison is made before the container is
+         * touched, so if anything throws the container is left as it was.
+         */
+        template <typename I, typename S>
+        requires std::input_iterator<I> and std::sentinel_for<S, I> and std::constructible_from<T, iter_reference_t<I>>
+        auto insert_range(I first, S last) -> void {
+            auto fresh = storage_type(m_data.get_allocator());
+            if constexpr (std::forward_iterator<I> and std::sized_sentinel_for<S, I>) {
+                fresh.reserve(static_cast<std::size_t>(last - first));
+            }
+            for (; first != last; ++first) { fresh.emplace_back(*first); }
+            if (fresh.empty()) { return; }
+
+            auto by_key = [this](T const &lhs, T const &rhs) { return meta::invoke(m_comp, meta::invoke(m_key, lhs), meta::invoke(m_key, rhs)); };
+            if (not std::is_sorted(fresh.begin(), fresh.end(), by_key)) {
+                std::stable_sort(fresh.begin(), fresh.end(), by_key);
+            }
+            const auto equivalent = [&by_key](T const &lhs, T const &rhs) { return not by_key(lhs, rhs); };
+            fresh.erase(std::unique(fresh.begin(), fresh.end(), equivalent), fresh.end());
+
+            if (m_data.empty()) {
+                m_data.swap(fresh);
+                return;
+            }
+            if (by_key(m_data.back(), fresh.front())) {
+                const auto old_size = m_data.size();
+                try {
+                    m_data.insert(m_data.end(), std::make_move_iterator(fresh.begin()), std::make_move_iterator(fresh.end()));
+                }
+                catch (...) {
+                    m_data.erase(m_data.begin() + static_cast<std::ptrdiff_t>(old_size), m_data.end());
+                    throw;
+                }
+                return;
+            }
+
+            // Where each new element goes among the existing ones, or skip if an equivalent one is already present.
+            constexpr auto skip = std::numeric_limits<std::size_t>::max();
+            auto slots = std::vector<std::size_t>(fresh.size());
+            auto kept = 0uz;
+            for (auto i = 0uz, j = 0uz; j < fresh.size(); ++j) {
+                while (i < m_data.size() and by_key(m_data[i], fresh[j])) { ++i; }
+                slots[j] = i < m_data.size() and not by_key(fresh[j], m_data[i]) ? skip : i;
+                kept += slots[j] != skip;
+            }
+            if (kept == 0) { return; }
+
+            // Without comparisons left to throw, elements are moved when that cannot throw and copied otherwise, so
+            // a failing copy leaves m_data intact.
+            auto merged = storage_type(m_data.get_allocator());
+            merged.reserve(m_data.size() + kept);
+            auto i = 0uz;
+            for (auto j = 0uz; j < fresh.size(); ++j) {
+                if (slots[j] == skip) { continue; }
+                for (; i < slots[j]; ++i) { merged.push_back(std::move_if_noexcept(m_data[i])); }
+                merged.push_back(std::move_if_noexcept(fresh[j]));
+            }
+            for (; i < m_data.size(); ++i) { merged.push_back(std::move_if_noexcept(m_data[i])); }
+            m_data.swap(merged);
+        }
+
+        template <typename Rng>
+        requires input_range<Rng> and std::constructible_from<T, range_reference_t<Rng>>
+        GENEX_INLINE auto insert_range(Rng &&rng) -> void {
+            insert_range(iterators::begin(rng), iterators::end(rng));
+        }
+
+        template <typename K>
+        GENEX_INLINE auto erase(K const &key) -> std::size_t {
+            const auto it = find(key);
+            if (it == m_data.cend()) { return 0; }
+            m_data.erase(it);
+            return 1;
+        }
+
+        GENEX_INLINE auto erase(const_iterator pos) -> const_iterator {
+            return m_data.erase(pos);
+        }
+
+        /**
+         * Lazy set operations against another range sorted by the same order, through @c views::set_*. @c other is
+         * projected to keys with @c proj2, which defaults to this container's own key projection so that two
+         * containers of the same kind combine directly. Both ranges must outlive the returned view.
+         */
+        template <typename Rng, typename Proj2 = KeyProj>
+        requires input_range<Rng const>
+        GENEX_NODISCARD GENEX_INLINE auto set_union(Rng const &other, Proj2 proj2 = {}) const {
+            return views::set_union(begin(), end(), iterators::begin(other), iterators::end(other), m_comp, m_key, std::move(proj2));
+        }
+
+        template <typename Rng, typename Proj2 = KeyProj>
+        requires input_range<Rng const>
+        GENEX_NODISCARD GENEX_INLINE auto set_intersection(Rng const &other, Proj2 proj2 = {}) const {
+            return views::set_intersection(begin(), end(), iterators::begin(other), iterators::end(other), m_comp, m_key, std::move(proj2));
+        }
+
+        template <typename Rng, typename Proj2 = KeyProj>
+        requires input_range<Rng const>
+        GENEX_NODISCARD GENEX_INLINE auto set_difference(Rng const &other, Proj2 proj2 = {}) const {
+            return views::set_difference(begin(), end(), iterators::begin(other), iterators::end(other), m_comp, m_key, std::move(proj2));
+        }
+
+        template <typename Rng, typename Proj2 = KeyProj>
+        requires input_range<Rng const>
+        GENEX_NODISCARD GENEX_INLINE auto set_symmetric_difference(Rng const &other, Proj2 proj2 = {}) const {
+            return views::set_symmetric_difference(begin(), end(), iterators::begin(other), iterators::end(other), m_comp, m_key, std::move(proj2));
+        }
+
+        GENEX_NODISCARD GENEX_INLINE friend auto operator==(flat_tree const &lhs, flat_tree const &rhs) -> bool {
+            return lhs.m_data == rhs.m_data;
+        }
+
+    protected:
+        template <typename K>
+        GENEX_INLINE auto holds_before(K const &key, T const &elem) const -> bool {
+            return meta::invoke(m_comp, key, meta::invoke(m_key, elem));
+        }
+
+        // Inserts value unless an element with an equivalent key exists; returns the element's position either way.
+        template <typename K, typename... Args>
+        auto emplace_unique(K const &key, Args &&... args) -> std::pair<typename storage_type::iterator, bool> {
+            const auto pos = m_data.begin() + (lower_bound(key) - m_data.cbegin());
+            if (pos != m_data.end() and not holds_before(key, *pos)) { return {pos, false}; }
+            return {m_data.emplace(pos, std::forward<Args>(args)...), true};
+        }
+    };
+}
+
+namespace genex::containers {
+    /**
+     * An ordered set of unique values stored in one sorted, contiguous buffer. Compared with the node-based
+     * @c std::set it iterates at the speed of a vector, uses no per-element allocation, and builds from a range in
+     * one sort; single inserts and erases move the tail and so cost O(n), which suits read-mostly tables (config,
+     * lookup and ID sets) rather than heavy churn. Values are immutable through iterators, since changing one could
+     * break the order.
+     * @tparam T The value type.
+     * @tparam Comp The strict weak order the values are kept in.
+     * @tparam Alloc The allocator of the underlying vector.
+     */
+    export template <typename T, typename Comp = operations::lt, typename Alloc = std::allocator<T>>
+    requires std::strict_weak_order<Comp&, T const&, T const&>
+    class flat_set : public detail::flat_tree<T, meta::identity, Comp, Alloc> {
+        using base = detail::flat_tree<T, meta::identity, Comp, Alloc>;
+
+    public:
+        using key_type = T;
+        using iterator = typename base::const_iterator;
+
+        using base::base;
+
+        GENEX_INLINE auto insert(T const &value) -> std::pair<iterator, bool> {
+            auto [it, inserted] = this->emplace_unique(value, value);
+            return {iterator(it), inserted};
+        }
+
+        GENEX_INLINE auto insert(T &&value) -> std::pair<iterator, bool> {
+            auto [it, inserted] = this->emplace_unique(value, std::move(value));
+            return {iterator(it), inserted};
+        }
+    };
+}
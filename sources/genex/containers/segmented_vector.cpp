@@ -0,0 +1,410 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.containers.segmented_vector;
+import genex.concepts;
+import std;
+
+namespace genex::containers {
+    export template <typename T, typename Alloc = std::allocator<T>>
+    class segmented_vector;
+}
+
+namespace genex::containers::detail {
+    /**
+     * Random access iterator over a @c segmented_vector. The current block's cursor and end are cached, so a linear
+     * walk is a pointer increment plus one well-predicted comparison; only crossing into the next block (or a random
+     * jump) goes back through the index arithmetic in the container.
+     */
+    template <bool Const, typename T, typename Alloc>
+    struct segmented_iterator {
+        using container_type = std::conditional_t<Const, segmented_vector<T, Alloc> const, segmented_vector<T, Alloc>>;
+        using elem_ptr = std::conditional_t<Const, T const*, T*>;
+
+        container_type *vec = nullptr;
+        std::size_t idx = 0;
+        elem_ptr cur = nullptr;
+        elem_ptr blk_end = nullptr;
+
+        using value_type = T;
+        using reference_type = std::conditional_t<Const, T const&, T&>;
+        using reference = reference_type;
+        using pointer = elem_ptr;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = iterator_category;
+
+        GENEX_INLINE constexpr segmented_iterator() = default;
+
+        GENEX_INLINE segmented_iterator(container_type *vec, const std::size_t idx) :
+            vec(vec), idx(idx) {
+            locate();
+        }
+
+        GENEX_INLINE operator segmented_iterator<true, T, Alloc>() const requires (not Const) {
+            return segmented_iterator<true, T, Alloc>(vec, idx);
+        }
+
+        GENEX_INLINE auto operator*() const -> reference_type {
+            return *cur;
+        }
+
+        GENEX_INLINE auto operator[](const difference_type n) const -> reference_type {
+            return (*vec)[idx + n];
+        }
+
+        GENEX_INLINE auto operator++() -> segmented_iterator& {
+            ++idx;
+            if (++cur == blk_end) { locate(); }
+            return *this;
+        }
+
+        GENEX_INLINE auto operator++(int) -> segmented_iterator {
+            auto temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        GENEX_INLINE auto operator--() -> segmented_iterator& {
+            --idx;
+            locate();
+            return *this;
+        }
+
+        GENEX_INLINE auto operator--(int) -> segmented_iterator {
+            auto temp = *this;
+            --*this;
+            return temp;
+        }
+
+        GENEX_INLINE auto operator+=(const difference_type n) -> segmented_iterator& {
+            idx += n;
+            locate();
+            return *this;
+        }
+
+        GENEX_INLINE auto operator-=(const difference_type n) -> segmented_iterator& {
+            idx -= n;
+            locate();
+            return *this;
+        }
+
+        GENEX_INLINE friend auto operator+(segmented_iterator it, const difference_type n) -> segmented_iterator {
+            return it += n;
+        }
+
+        GENEX_INLINE friend auto operator+(const difference_type n, segmented_iterator it) -> segmented_iterator {
+            return it += n;
+        }
+
+        GENEX_INLINE friend auto operator-(segmented_iterator it, const difference_type n) -> segmented_iterator {
+            return it -= n;
+        }
+
+        GENEX_INLINE friend auto operator-(segmented_iterator const &lhs, segmented_iterator const &rhs) -> difference_type {
+            return static_cast<difference_type>(lhs.idx) - static_cast<difference_type>(rhs.idx);
+        }
+
+        GENEX_INLINE friend auto operator==(segmented_iterator const &lhs, segmented_iterator const &rhs) -> bool {
+            return lhs.idx == rhs.idx;
+        }
+
+        GENEX_INLINE friend auto operator<=>(segmented_iterator const &lhs, segmented_iterator const &rhs) -> std::strong_ordering {
+            return lhs.idx <=> rhs.idx;
+        }
+
+    private:
+        GENEX_INLINE auto locate() -> void {
+            auto [blk, off] = container_type::split_index(idx);
+            if (blk < vec->m_blocks.size()) {
+                cur = vec->m_blocks[blk] + off;
+                blk_end = vec->m_blocks[blk] + container_type::block_size(blk);
+            }
+            else {
+                cur = blk_end = nullptr;
+            }
+        }
+    };
+}
+
+namespace genex::containers {
+    /**
+     * An append-only friendly sequence stored as a chain of blocks whose sizes double (@c first_block, then twice
+     * that, and so on). Appending never relocates existing elements, so materialising a range of unknown length copies
+     * each element exactly once and peak memory stays within 2x of the final size, rather than the ~3x a growing
+     * @c std::vector reaches mid-reallocation. Block sizes are powers of two, so the block and offset of any index are
+     * found with a couple of bit operations and random access stays O(1).
+     *
+     * Usable as a @c genex::to target and a @c views::materialize_into cache. Once the final size is known, @c flatten
+     * produces an exactly-sized @c std::vector (moving the elements out when called on an rvalue).
+     * @tparam T The element type.
+     * @tparam Alloc The allocator used for the blocks.
+     */
+    export template <typename T, typename Alloc>
+    class segmented_vector {
+        template <bool, typename, typename>
+        friend struct detail::segmented_iterator;
+
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        std::vector<T*> m_blocks;
+        std::size_t m_size = 0;
+        GENEX_NO_UNIQUE_ADDRESS Alloc m_alloc;
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using reference = T&;
+        using const_reference = T const&;
+        using iterator = detail::segmented_iterator<false, T, Alloc>;
+        using const_iterator = detail::segmented_iterator<true, T, Alloc>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        static constexpr std::size_t first_block = std::bit_ceil(std::max<std::size_t>(16, 512 / sizeof(T)));
+
+        GENEX_INLINE segmented_vector() = default;
+
+        GENEX_INLINE explicit segmented_vector(Alloc const &alloc) noexcept :
+            m_alloc(alloc) {
+        }
+
+        template <typename I, typename S>
+        requires std::input_iterator<I> and std::sentinel_for<S, I> and std::constructible_from<T, iter_reference_t<I>>
+        GENEX_INLINE segmented_vector(I first, S last, Alloc const &alloc = Alloc()) :
+            m_alloc(alloc) {
+            // The destructor does not run for a constructor that throws, so the partial contents are freed here.
+            try {
+                if constexpr (std::sized_sentinel_for<S, I>) {
+                    reserve(static_cast<std::size_t>(last - first));
+                }
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            }
+            catch (...) {
+                clear();
+                release_blocks();
+                throw;
+            }
+        }
+
+        GENEX_INLINE segmented_vector(std::initializer_list<T> il, Alloc const &alloc = Alloc()) :
+            segmented_vector(il.begin(), il.end(), alloc) {
+        }
+
+        GENEX_INLINE segmented_vector(segmented_vector const &that) :
+            segmented_vector(that.begin(), that.end(), alloc_traits::select_on_container_copy_construction(that.m_alloc)) {
+        }
+
+        GENEX_INLINE segmented_vector(segmented_vector &&that) noexcept :
+            m_blocks(std::move(that.m_blocks)), m_size(std::exchange(that.m_size, 0)), m_alloc(std::move(that.m_alloc)) {
+            that.m_blocks.clear();
+        }
+
+        GENEX_INLINE ~segmented_vector() {
+            clear();
+            release_blocks();
+        }
+
+        GENEX_INLINE auto operator=(segmented_vector const &that) -> segmented_vector& {
+            if (this != std::addressof(that)) {
+                clear();
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                    // Blocks must be returned to the allocator that made them before that allocator is replaced.
+                    if (not allocators_equal(that)) { release_blocks(); }
+                    m_alloc = that.m_alloc;
+                }
+                reserve(that.m_size);
+                for (auto const &elem : that) { emplace_back(elem); }
+            }
+            return *this;
+        }
+
+        /**
+         * Takes over @c that's blocks when the allocator propagates on move assignment (and is moved over with them)
+         * or both allocators compare equal. Otherwise, e.g. for two arenas, the blocks belong to the other allocator,
+         * so the elements are moved one by one into blocks from this vector's own allocator.
+         */
+        GENEX_INLINE auto operator=(segmented_vector &&that) noexcept(
+            alloc_traits::propagate_on_container_move_assignment::value or alloc_traits::is_always_equal::value) -> segmented_vector& {
+            if (this != std::addressof(that)) {
+                clear();
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                    release_blocks();
+                    m_alloc = std::move(that.m_alloc);
+                    steal_from(std::move(that));
+                }
+                else {
+                    if (allocators_equal(that)) {
+                        release_blocks();
+                        steal_from(std::move(that));
+                    }
+                    else {
+                        reserve(that.m_size);
+                        for (auto &elem : that) { emplace_back(std::move(elem)); }
+                        that.clear();
+                    }
+                }
+            }
+            return *this;
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto get_allocator() const noexcept -> Alloc {
+            return m_alloc;
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto size(this Self &&self) noexcept -> std::size_t {
+            return self.m_size;
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto capacity(this Self &&self) noexcept -> std::size_t {
+            return first_block * ((std::size_t{1} << self.m_blocks.size()) - 1);
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto empty(this Self &&self) noexcept -> bool {
+            return self.m_size == 0;
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            using iter_t = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+            return iter_t(std::addressof(self), 0);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            using iter_t = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+            return iter_t(std::addressof(self), self.m_size);
+        }
+
+        template <typename Self>
+        GENEX_INLINE constexpr auto operator[](this Self &&self, const std::size_t index) noexcept -> decltype(auto) {
+            auto [blk, off] = split_index(index);
+            if constexpr (std::is_const_v<std::remove_reference_t<Self>>) { return static_cast<T const&>(self.m_blocks[blk][off]); }
+            else { return (self.m_blocks[blk][off]); }
+        }
+
+        template <typename Self>
+        GENEX_INLINE auto front(this Self &&self) noexcept -> decltype(auto) {
+            return self[0];
+        }
+
+        template <typename Self>
+        GENEX_INLINE auto back(this Self &&self) noexcept -> decltype(auto) {
+            return self[self.m_size - 1];
+        }
+
+        GENEX_INLINE auto reserve(const std::size_t new_cap) -> void {
+            while (capacity() < new_cap) { add_block(); }
+        }
+
+        template <typename... Args>
+        requires std::constructible_from<T, Args&&...>
+        GENEX_INLINE auto emplace_back(Args &&... args) -> T& {
+            auto [blk, off] = split_index(m_size);
+            if (blk == m_blocks.size()) { add_block(); }
+            auto *elem = std::construct_at(m_blocks[blk] + off, std::forward<Args>(args)...);
+            ++m_size;
+            return *elem;
+        }
+
+        GENEX_INLINE auto push_back(T const &elem) -> void {
+            emplace_back(elem);
+        }
+
+        GENEX_INLINE auto push_back(T &&elem) -> void {
+            emplace_back(std::move(elem));
+        }
+
+        GENEX_INLINE auto pop_back() noexcept -> void {
+            --m_size;
+            std::destroy_at(std::addressof((*this)[m_size]));
+        }
+
+        /**
+         * Destroys every element but keeps the blocks, so refilling up to the previous size allocates nothing.
+         */
+        GENEX_INLINE auto clear() noexcept -> void {
+            for_each_block([](T *first, T *last) { std::destroy(first, last); });
+            m_size = 0;
+        }
+
+        /**
+         * Gathers the elements into a single contiguous, exactly-sized @c std::vector. On an rvalue the elements are
+         * moved out block by block; otherwise they are copied.
+         */
+        template <typename Self>
+        GENEX_NODISCARD auto flatten(this Self &&self) -> std::vector<T> {
+            constexpr auto steal = not std::is_lvalue_reference_v<Self> and not std::is_const_v<std::remove_reference_t<Self>>;
+            auto out = std::vector<T>();
+            out.reserve(self.m_size);
+            self.for_each_block([&out](auto *first, auto *last) {
+                if constexpr (steal) { out.insert(out.end(), std::make_move_iterator(first), std::make_move_iterator(last)); }
+                else { out.insert(out.end(), first, last); }
+            });
+            return out;
+        }
+
+        GENEX_INLINE friend auto operator==(segmented_vector const &lhs, segmented_vector const &rhs) -> bool requires std::equality_comparable<T> {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+    private:
+        GENEX_INLINE static constexpr auto block_size(const std::size_t blk) noexcept -> std::size_t {
+            return first_block << blk;
+        }
+
+        GENEX_INLINE static constexpr auto split_index(const std::size_t index) noexcept -> std::pair<std::size_t, std::size_t> {
+            // Block k covers [first_block * (2^k - 1), first_block * (2^(k+1) - 1)), so offsetting the index by
+            // first_block makes the block number the position of the highest set bit above log2(first_block).
+            constexpr auto shift = static_cast<std::size_t>(std::countr_zero(first_block));
+            const auto biased = index + first_block;
+            const auto blk = static_cast<std::size_t>(std::bit_width(biased)) - 1 - shift;
+            return {blk, biased - block_size(blk)};
+        }
+
+        GENEX_INLINE auto add_block() -> void {
+            const auto n = block_size(m_blocks.size());
+            auto *block = alloc_traits::allocate(m_alloc, n);
+            try {
+                m_blocks.push_back(block);
+            }
+            catch (...) {
+                alloc_traits::deallocate(m_alloc, block, n);
+                throw;
+            }
+        }
+
+        GENEX_INLINE auto release_blocks() noexcept -> void {
+            for (auto blk = 0uz; blk < m_blocks.size(); ++blk) {
+                alloc_traits::deallocate(m_alloc, m_blocks[blk], block_size(blk));
+            }
+            m_blocks.clear();
+        }
+
+        GENEX_INLINE auto allocators_equal(segmented_vector const &that) const noexcept -> bool {
+            if constexpr (alloc_traits::is_always_equal::value) { return true; }
+            else { return m_alloc == that.m_alloc; }
+        }
+
+        GENEX_INLINE auto steal_from(segmented_vector &&that) noexcept -> void {
+            m_blocks = std::move(that.m_blocks);
+            m_size = std::exchange(that.m_size, 0);
+            that.m_blocks.clear();
+        }
+
+        template <typename Self, typename F>
+        GENEX_INLINE auto for_each_block(this Self &&self, F &&f) -> void {
+            auto remaining = self.m_size;
+            for (auto blk = 0uz; remaining > 0; ++blk) {
+                const auto n = std::min(remaining, block_size(blk));
+                f(self.m_blocks[blk], self.m_blocks[blk] + n);
+                remaining -= n;
+            }
+        }
+    };
+}
@@ -0,0 +1,333 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.containers.small_vector;
+import genex.concepts;
+import std;
+
+namespace genex::containers {
+    /**
+     * A contiguous, growable sequence that keeps its first @c N elements in storage embedded in the object itself,
+     * and only moves to the heap (through @c Alloc) once the size exceeds @c N. Materialising short ranges into a
+     * @c small_vector therefore never touches the allocator, which is the point: it is intended as a drop-in cache
+     * for @c views::materialize_into and a target for @c genex::to when most inputs are small.
+     *
+     * The interface is the subset of @c std::vector used by the rest of the library (@c push_back, @c emplace_back,
+     * @c reserve, @c size, contiguous @c begin / @c end, ...), so it satisfies the same concepts. Moving a
+     * @c small_vector that is still inline moves its elements one by one; moving a heap-backed one steals the buffer
+     * (on assignment, only if the allocator propagates or compares equal, as for @c std::vector).
+     * @tparam T The element type.
+     * @tparam N The number of elements stored inline before spilling to the heap.
+     * @tparam Alloc The allocator used once the inline capacity is exhausted.
+     */
+    export template <typename T, std::size_t N, typename Alloc = std::allocator<T>>
+    requires (N > 0)
+    class small_vector {
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        T *m_data;
+        std::size_t m_size = 0;
+        std::size_t m_capacity = N;
+        GENEX_NO_UNIQUE_ADDRESS Alloc m_alloc;
+        alignas(T) std::byte m_inline[N * sizeof(T)];
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using reference = T&;
+        using const_reference = T const&;
+        using iterator = T*;
+        using const_iterator = T const*;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        static constexpr std::size_t inline_capacity = N;
+
+        GENEX_INLINE small_vector() noexcept(std::is_nothrow_default_constructible_v<Alloc>) :
+            m_data(inline_ptr()) {
+        }
+
+        GENEX_INLINE explicit small_vector(Alloc const &alloc) noexcept :
+            m_data(inline_ptr()), m_alloc(alloc) {
+        }
+
+        template <typename I, typename S>
+        requires std::input_iterator<I> and std::sentinel_for<S, I> and std::constructible_from<T, iter_reference_t<I>>
+        GENEX_INLINE small_vector(I first, S last, Alloc const &alloc = Alloc()) :
+            m_data(inline_ptr()), m_alloc(alloc) {
+            // The destructor does not run for a constructor that throws, so the partial contents are freed here.
+            try {
+                if constexpr (std::sized_sentinel_for<S, I>) {
+                    reserve(static_cast<std::size_t>(last - first));
+                }
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            }
+            catch (...) {
+                clear();
+                release_heap();
+                throw;
+            }
+        }
+
+        GENEX_INLINE small_vector(std::initializer_list<T> il, Alloc const &alloc = Alloc()) :
+            small_vector(il.begin(), il.end(), alloc) {
+        }
+
+        GENEX_INLINE small_vector(small_vector const &that) :
+            small_vector(that.begin(), that.end(), alloc_traits::select_on_container_copy_construction(that.m_alloc)) {
+        }
+
+        GENEX_INLINE small_vector(small_vector &&that) noexcept(std::is_nothrow_move_constructible_v<T>) :
+            m_data(inline_ptr()), m_alloc(std::move(that.m_alloc)) {
+            steal_from(std::move(that));
+        }
+
+        GENEX_INLINE ~small_vector() {
+            clear();
+            release_heap();
+        }
+
+        GENEX_INLINE auto operator=(small_vector const &that) -> small_vector& {
+            if (this != std::addressof(that)) {
+                clear();
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                    // A heap buffer must be returned to the allocator that made it before that allocator is replaced.
+                    if (not allocators_equal(that)) { release_heap(); }
+                    m_alloc = that.m_alloc;
+                }
+                reserve(that.m_size);
+                std::uninitialized_copy(that.begin(), that.end(), m_data);
+                m_size = that.m_size;
+            }
+            return *this;
+        }
+
+        /**
+         * Takes over @c that's heap buffer when the allocators allow it: either the allocator propagates on move
+         * assignment (and is moved over with the buffer), or both allocators compare equal. Otherwise the buffer
+         * belongs to a different allocator (e.g. another memory resource), so the elements are moved one by one into
+         * storage from this vector's own allocator.
+         */
+        GENEX_INLINE auto operator=(small_vector &&that) noexcept(
+            std::is_nothrow_move_constructible_v<T> and
+            (alloc_traits::propagate_on_container_move_assignment::value or alloc_traits::is_always_equal::value)) -> small_vector& {
+            if (this != std::addressof(that)) {
+                clear();
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                    release_heap();
+                    m_alloc = std::move(that.m_alloc);
+                    steal_from(std::move(that));
+                }
+                else {
+                    if (allocators_equal(that)) {
+                        release_heap();
+                        steal_from(std::move(that));
+                    }
+                    else {
+                        reserve(that.m_size);
+                        std::uninitialized_move(that.m_data, that.m_data + that.m_size, m_data);
+                        m_size = that.m_size;
+                        that.clear();
+                    }
+                }
+            }
+            return *this;
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto data(this Self &&self) noexcept -> auto {
+            return self.ptr();
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto size(this Self &&self) noexcept -> std::size_t {
+            return self.m_size;
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto capacity(this Self &&self) noexcept -> std::size_t {
+            return self.m_capacity;
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto empty(this Self &&self) noexcept -> bool {
+            return self.m_size == 0;
+        }
+
+        GENEX_NODISCARD GENEX_INLINE auto get_allocator() const noexcept -> Alloc {
+            return m_alloc;
+        }
+
+        /**
+         * Whether the elements currently live in the inline buffer, i.e. no allocation has been made.
+         */
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE auto is_inline(this Self &&self) noexcept -> bool {
+            return self.m_data == self.inline_ptr();
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            return self.ptr();
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            return self.ptr() + self.m_size;
+        }
+
+        template <typename Self>
+        GENEX_INLINE constexpr auto operator[](this Self &&self, const std::size_t index) noexcept -> decltype(auto) {
+            return self.ptr()[index];
+        }
+
+        template <typename Self>
+        GENEX_INLINE auto front(this Self &&self) noexcept -> decltype(auto) {
+            return *self.ptr();
+        }
+
+        template <typename Self>
+        GENEX_INLINE auto back(this Self &&self) noexcept -> decltype(auto) {
+            return *(self.ptr() + self.m_size - 1);
+        }
+
+        GENEX_INLINE auto reserve(const std::size_t new_cap) -> void {
+            if (new_cap > m_capacity) { reallocate(new_cap); }
+        }
+
+        template <typename... Args>
+        requires std::constructible_from<T, Args&&...>
+        GENEX_INLINE auto emplace_back(Args &&... args) -> T& {
+            if (m_size == m_capacity) {
+                // Construct into the new buffer before relocating, so arguments aliasing an existing element stay valid.
+                return grow_and_emplace(std::forward<Args>(args)...);
+            }
+            auto *elem = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            ++m_size;
+            return *elem;
+        }
+
+        GENEX_INLINE auto push_back(T const &elem) -> void {
+            emplace_back(elem);
+        }
+
+        GENEX_INLINE auto push_back(T &&elem) -> void {
+            emplace_back(std::move(elem));
+        }
+
+        GENEX_INLINE auto pop_back() noexcept -> void {
+            --m_size;
+            std::destroy_at(m_data + m_size);
+        }
+
+        GENEX_INLINE auto clear() noexcept -> void {
+            std::destroy_n(m_data, m_size);
+            m_size = 0;
+        }
+
+        GENEX_INLINE auto resize(const std::size_t new_size) -> void requires std::default_initializable<T> {
+            if (new_size < m_size) {
+                std::destroy(m_data + new_size, m_data + m_size);
+            }
+            else {
+                reserve(new_size);
+                std::uninitialized_value_construct(m_data + m_size, m_data + new_size);
+            }
+            m_size = new_size;
+        }
+
+        GENEX_INLINE friend auto operator==(small_vector const &lhs, small_vector const &rhs) -> bool requires std::equality_comparable<T> {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+    private:
+        template <typename Self>
+        GENEX_INLINE auto inline_ptr(this Self &&self) noexcept -> auto {
+            if constexpr (std::is_const_v<std::remove_reference_t<Self>>) { return reinterpret_cast<T const*>(self.m_inline); }
+            else { return reinterpret_cast<T*>(self.m_inline); }
+        }
+
+        template <typename Self>
+        GENEX_INLINE constexpr auto ptr(this Self &&self) noexcept -> auto {
+            if constexpr (std::is_const_v<std::remove_reference_t<Self>>) { return static_cast<T const*>(self.m_data); }
+            else { return self.m_data; }
+        }
+
+        GENEX_INLINE auto relocate_into(T *dst) -> void {
+            if constexpr (std::is_nothrow_move_constructible_v<T> or not std::copy_constructible<T>) {
+                std::uninitialized_move(m_data, m_data + m_size, dst);
+            }
+            else {
+                std::uninitialized_copy(m_data, m_data + m_size, dst);
+            }
+            std::destroy_n(m_data, m_size);
+        }
+
+        GENEX_INLINE auto release_heap() noexcept -> void {
+            if (not is_inline()) {
+                alloc_traits::deallocate(m_alloc, m_data, m_capacity);
+                m_data = inline_ptr();
+                m_capacity = N;
+            }
+        }
+
+        GENEX_INLINE auto allocators_equal(small_vector const &that) const noexcept -> bool {
+            if constexpr (alloc_traits::is_always_equal::value) { return true; }
+            else { return m_alloc == that.m_alloc; }
+        }
+
+        // The old buffer is only released once every element has reached the new one; if relocation throws, the new
+        // buffer is returned and the vector is left as it was.
+        auto reallocate(const std::size_t new_cap) -> void {
+            auto *new_data = alloc_traits::allocate(m_alloc, new_cap);
+            try {
+                relocate_into(new_data);
+            }
+            catch (...) {
+                alloc_traits::deallocate(m_alloc, new_data, new_cap);
+                throw;
+            }
+            release_heap();
+            m_data = new_data;
+            m_capacity = new_cap;
+        }
+
+        template <typename... Args>
+        auto grow_and_emplace(Args &&... args) -> T& {
+            const auto new_cap = m_capacity * 2;
+            auto *new_data = alloc_traits::allocate(m_alloc, new_cap);
+            T *elem = nullptr;
+            try {
+                elem = std::construct_at(new_data + m_size, std::forward<Args>(args)...);
+                relocate_into(new_data);
+            }
+            catch (...) {
+                if (elem != nullptr) { std::destroy_at(elem); }
+                alloc_traits::deallocate(m_alloc, new_data, new_cap);
+                throw;
+            }
+            release_heap();
+            m_data = new_data;
+            m_capacity = new_cap;
+            ++m_size;
+            return *elem;
+        }
+
+        auto steal_from(small_vector &&that) -> void {
+            if (that.is_inline()) {
+                std::uninitialized_move(that.m_data, that.m_data + that.m_size, m_data);
+                m_size = that.m_size;
+                that.clear();
+            }
+            else {
+                m_data = std::exchange(that.m_data, that.inline_ptr());
+                m_size = std::exchange(that.m_size, 0);
+                m_capacity = std::exchange(that.m_capacity, N);
+            }
+        }
+    };
+}
@@ -0,0 +1,235 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.containers.soa_vector;
+import genex.concepts;
+import genex.span;
+import std;
+
+namespace genex::containers {
+    export template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    class soa_vector;
+}
+
+namespace genex::containers::detail {
+    /**
+     * Random access iterator over the rows of a @c soa_vector. Dereferencing yields a @c std::tuple of references
+     * into each column (the row proxy), and the value type is the matching @c std::tuple of values, which is the same
+     * shape @c views::zip produces, so rows can flow into @c views::tuple_nth or back into a @c soa_vector.
+     */
+    template <bool Const, typename... Ts>
+    struct soa_iterator {
+        using container_type = std::conditional_t<Const, soa_vector<Ts...> const, soa_vector<Ts...>>;
+
+        container_type *vec = nullptr;
+        std::ptrdiff_t idx = 0;
+
+        using value_type = std::tuple<Ts...>;
+        using reference_type = std::conditional_t<Const, std::tuple<Ts const&...>, std::tuple<Ts&...>>;
+        using reference = reference_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = iterator_category;
+
+        GENEX_INLINE constexpr soa_iterator() = default;
+
+        GENEX_INLINE constexpr soa_iterator(container_type *vec, const std::ptrdiff_t idx) :
+            vec(vec), idx(idx) {
+        }
+
+        GENEX_INLINE constexpr operator soa_iterator<true, Ts...>() const requires (not Const) {
+            return soa_iterator<true, Ts...>(vec, idx);
+        }
+
+        GENEX_INLINE constexpr auto operator*() const -> reference_type {
+            return (*vec)[static_cast<std::size_t>(idx)];
+        }
+
+        GENEX_INLINE constexpr auto operator[](const difference_type n) const -> reference_type {
+            return (*vec)[static_cast<std::size_t>(idx + n)];
+        }
+
+        GENEX_INLINE constexpr auto operator++() -> soa_iterator& {
+            ++idx;
+            return *this;
+        }
+
+        GENEX_INLINE constexpr auto operator++(int) -> soa_iterator {
+            auto temp = *this;
+            ++idx;
+            return temp;
+        }
+
+        GENEX_INLINE constexpr auto operator--() -> soa_iterator& {
+            --idx;
+            return *this;
+        }
+
+        GENEX_INLINE constexpr auto operator--(int) -> soa_iterator {
+            auto temp = *this;
+            --idx;
+            return temp;
+        }
+
+        GENEX_INLINE constexpr auto operator+=(const difference_type n) -> soa_iterator& {
+            idx += n;
+            return *this;
+        }
+
+        GENEX_INLINE constexpr auto operator-=(const difference_type n) -> soa_iterator& {
+            idx -= n;
+            return *this;
+        }
+
+        GENEX_INLINE friend constexpr auto operator+(soa_iterator it, const difference_type n) -> soa_iterator {
+            return it += n;
+        }
+
+        GENEX_INLINE friend constexpr auto operator+(const difference_type n, soa_iterator it) -> soa_iterator {
+            return it += n;
+        }
+
+        GENEX_INLINE friend constexpr auto operator-(soa_iterator it, const difference_type n) -> soa_iterator {
+            return it -= n;
+        }
+
+        GENEX_INLINE friend constexpr auto operator-(soa_iterator const &lhs, soa_iterator const &rhs) -> difference_type {
+            return lhs.idx - rhs.idx;
+        }
+
+        GENEX_INLINE friend constexpr auto operator==(soa_iterator const &lhs, soa_iterator const &rhs) -> bool {
+            return lhs.idx == rhs.idx;
+        }
+
+        GENEX_INLINE friend constexpr auto operator<=>(soa_iterator const &lhs, soa_iterator const &rhs) -> std::strong_ordering {
+            return lhs.idx <=> rhs.idx;
+        }
+    };
+}
+
+namespace genex::containers {
+    /**
+     * A structure-of-arrays sequence: each of the @c Ts is stored in its own contiguous column, but the container can
+     * still be iterated (and appended to) row by row. Scans that only touch a few fields should read the columns
+     * directly through @c column<N>, which is a plain contiguous span and therefore works with every view; iterating
+     * the container itself yields row proxies (tuples of references) for when a whole record is needed.
+     *
+     * Rows are appended as tuples (what @c views::zip yields), so @c genex::to<soa_vector<Ts...>> and
+     * @c genex::unzip_to<soa_vector> both work as sinks for zipped pipelines.
+     * @tparam Ts The column types.
+     */
+    export template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+    class soa_vector {
+        std::tuple<std::vector<Ts>...> m_columns;
+
+        using index_seq = std::index_sequence_for<Ts...>;
+
+    public:
+        using value_type = std::tuple<Ts...>;
+        using reference = std::tuple<Ts&...>;
+        using const_reference = std::tuple<Ts const&...>;
+        using iterator = detail::soa_iterator<false, Ts...>;
+        using const_iterator = detail::soa_iterator<true, Ts...>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <std::size_t N>
+        using column_type = std::tuple_element_t<N, std::tuple<Ts...>>;
+
+        GENEX_INLINE soa_vector() = default;
+
+        template <typename I, typename S>
+        requires std::input_iterator<I> and std::sentinel_for<S, I> and tuple_like<iter_value_t<I>>
+        GENEX_INLINE soa_vector(I first, S last) {
+            if constexpr (std::sized_sentinel_for<S, I>) {
+                reserve(static_cast<std::size_t>(last - first));
+            }
+            for (; first != last; ++first) {
+                push_back(*first);
+            }
+        }
+
+        GENEX_INLINE soa_vector(std::initializer_list<value_type> il) :
+            soa_vector(il.begin(), il.end()) {
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto size(this Self &&self) noexcept -> std::size_t {
+            return std::get<0>(self.m_columns).size();
+        }
+
+        template <typename Self>
+        GENEX_NODISCARD GENEX_INLINE constexpr auto empty(this Self &&self) noexcept -> bool {
+            return std::get<0>(self.m_columns).empty();
+        }
+
+        /**
+         * The contiguous storage of the @c N th field, as a span that can be fed directly into any view.
+         */
+        template <std::size_t N, typename Self>
+        requires (N < sizeof...(Ts))
+        GENEX_NODISCARD GENEX_INLINE constexpr auto column(this Self &&self) noexcept -> genex::span<column_type<N>> {
+            auto &col = std::get<N>(self.m_columns);
+            return genex::span<column_type<N>>(col.data(), col.size());
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            using iter_t = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+            return iter_t(std::addressof(self), 0);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            using iter_t = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, const_iterator, iterator>;
+            return iter_t(std::addressof(self), static_cast<std::ptrdiff_t>(self.size()));
+        }
+
+        template <typename Self>
+        GENEX_INLINE constexpr auto operator[](this Self &&self, const std::size_t index) noexcept -> auto {
+            return self.row_at(index, index_seq{});
+        }
+
+        GENEX_INLINE auto reserve(const std::size_t new_cap) -> void {
+            std::apply([new_cap](auto &... cols) { (cols.reserve(new_cap), ...); }, m_columns);
+        }
+
+        GENEX_INLINE auto clear() noexcept -> void {
+            std::apply([](auto &... cols) { (cols.clear(), ...); }, m_columns);
+        }
+
+        template <typename... Args>
+        requires (sizeof...(Args) == sizeof...(Ts)) and (std::constructible_from<Ts, Args&&> and ...)
+        GENEX_INLINE auto emplace_back(Args &&... args) -> void {
+            emplace_back_impl(index_seq{}, std::forward<Args>(args)...);
+        }
+
+        template <typename Tup>
+        requires tuple_like<Tup> and (std::tuple_size_v<std::remove_cvref_t<Tup>> == sizeof...(Ts))
+        GENEX_INLINE auto push_back(Tup &&row) -> void {
+            std::apply([this]<typename... Args>(Args &&... args) { emplace_back(std::forward<Args>(args)...); }, std::forward<Tup>(row));
+        }
+
+        GENEX_INLINE auto pop_back() -> void {
+            std::apply([](auto &... cols) { (cols.pop_back(), ...); }, m_columns);
+        }
+
+        GENEX_INLINE friend auto operator==(soa_vector const &lhs, soa_vector const &rhs) -> bool requires (std::equality_comparable<Ts> and ...) {
+            return lhs.m_columns == rhs.m_columns;
+        }
+
+    private:
+        template <typename Self, std::size_t... Is>
+        GENEX_INLINE constexpr auto row_at(this Self &&self, const std::size_t index, std::index_sequence<Is...>) noexcept -> auto {
+            return std::tie(std::get<Is>(self.m_columns)[index]...);
+        }
+
+        template <std::size_t... Is, typename... Args>
+        GENEX_INLINE auto emplace_back_impl(std::index_sequence<Is...>, Args &&... args) -> void {
+            (std::get<Is>(m_columns).emplace_back(std::forward<Args>(args)), ...);
+        }
+    };
+}
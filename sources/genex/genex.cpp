@@ -2,6 +2,7 @@ export module genex;
 
 // Core modules
 export import genex.concepts;
+export import genex.memory;
 export import genex.meta;
 export import genex.pipe;
 export import genex.span;
@@ -14,10 +15,13 @@ export import genex.actions.drop;
 export import genex.actions.drop_while;
 export import genex.actions.erase;
 export import genex.actions.insert;
+export import genex.actions.nth_element;
+export import genex.actions.partial_sort;
 export import genex.actions.pop_back;
 export import genex.actions.pop_front;
 export import genex.actions.push_back;
 export import genex.actions.push_front;
+export import genex.actions.radix_sort;
 export import genex.actions.remove;
 export import genex.actions.remove_if;
 export import genex.actions.replace;
@@ -26,6 +30,8 @@ export import genex.actions.reverse;
 export import genex.actions.shuffle;
 export import genex.actions.slice;
 export import genex.actions.sort;
+export import genex.actions.sort_by_cached_key;
+export import genex.actions.string_sort;
 export import genex.actions.take;
 export import genex.actions.take_while;
 
@@ -33,12 +39,15 @@ export import genex.actions.take_while;
 export import genex.algorithms.all_of;
 export import genex.algorithms.any_of;
 export import genex.algorithms.binary_search;
+export import genex.algorithms.bounds;
 export import genex.algorithms.concepts;
 export import genex.algorithms.contains;
 export import genex.algorithms.contains_if;
 export import genex.algorithms.count;
 export import genex.algorithms.count_if;
 export import genex.algorithms.equals;
+export import genex.algorithms.external_sort;
+export import genex.algorithms.eytzinger_index;
 export import genex.algorithms.find;
 export import genex.algorithms.find_if;
 export import genex.algorithms.find_if_not;
@@ -49,14 +58,27 @@ export import genex.algorithms.fold_left;
 export import genex.algorithms.fold_left_first;
 export import genex.algorithms.fold_right;
 export import genex.algorithms.fold_right_first;
+export import genex.algorithms.interpolation_search;
+export import genex.algorithms.learned_index;
+export import genex.algorithms.lower_bound_many;
 export import genex.algorithms.max_element;
 export import genex.algorithms.min_element;
 export import genex.algorithms.none_of;
 export import genex.algorithms.position;
 export import genex.algorithms.position_last;
+export import genex.algorithms.set_intersection_into;
 export import genex.algorithms.sorted;
+export import genex.algorithms.sorted_by_cached_key;
+export import genex.algorithms.sorted_indices;
 export import genex.algorithms.tuple;
 
+// Containers
+export import genex.containers.flat_map;
+export import genex.containers.flat_set;
+export import genex.containers.segmented_vector;
+export import genex.containers.small_vector;
+export import genex.containers.soa_vector;
+
 // Conditionals
 export import genex.conditional.if_;
 
@@ -82,6 +104,7 @@ export import genex.views2.address_of;
 export import genex.views2.cast_dynamic;
 export import genex.views2.cast_static;
 export import genex.views2.chunk;
+export import genex.views2.chunk_by;
 export import genex.views2.concat;
 export import genex.views2.cycle;
 export import genex.views2.drop;
@@ -90,17 +113,22 @@ export import genex.views2.drop_while;
 export import genex.views2.duplicates;
 export import genex.views2.enumerate;
 export import genex.views2.filter;
+export import genex.views2.hash_join;
 export import genex.views2.in;
 export import genex.views2.indirect;
 export import genex.views2.interleave;
+export import genex.views2.intersect_all;
 export import genex.views2.intersperse;
 export import genex.views2.iota;
 export import genex.views2.join;
 export import genex.views2.join_with;
 export import genex.views2.map;
 export import genex.views2.materialize;
+export import genex.views2.merge;
+export import genex.views2.merge_join;
 export import genex.views2.move;
 export import genex.views2.move_reverse;
+export import genex.views2.permute;
 export import genex.views2.ptr;
 export import genex.views2.remove;
 export import genex.views2.remove_if;
@@ -109,10 +137,12 @@ export import genex.views2.replace_if;
 export import genex.views2.reverse;
 export import genex.views2.set_algorithms;
 export import genex.views2.slice;
+export import genex.views2.sort_lazy;
 export import genex.views2.split;
 export import genex.views2.take;
 export import genex.views2.take_last;
 export import genex.views2.take_while;
+export import genex.views2.top_k;
 export import genex.views2.transform;
 export import genex.views2.tuple_nth;
 export import genex.views2.view;
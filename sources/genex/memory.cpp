@@ -0,0 +1,95 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.memory;
+import std;
+
+export namespace genex {
+    template <typename A>
+    concept allocator_like = requires(A &a, std::size_t n) {
+        typename A::value_type;
+        a.deallocate(a.allocate(n), n);
+    };
+
+    template <typename A>
+    concept memory_resource_like =
+        std::convertible_to<A, std::pmr::memory_resource*>;
+
+    template <typename A>
+    concept allocator_or_resource =
+        allocator_like<std::remove_cvref_t<A>> or
+        memory_resource_like<A>;
+}
+
+namespace genex {
+    template <typename T>
+    struct rebind_allocator_fn {
+        /**
+         * Turns an allocator (of any value type) or a memory resource pointer into an allocator for @c T. Memory
+         * resources (including @c genex::arena) become a @c std::pmr::polymorphic_allocator over that resource, so
+         * every allocator-aware entry point in the library accepts both forms.
+         */
+        template <typename A>
+        requires allocator_or_resource<A>
+        GENEX_INLINE constexpr auto operator()(A const &a) const noexcept -> auto {
+            if constexpr (memory_resource_like<A const&>) {
+                return std::pmr::polymorphic_allocator<T>(static_cast<std::pmr::memory_resource*>(a));
+            }
+            else {
+                return typename std::allocator_traits<std::remove_cvref_t<A>>::template rebind_alloc<T>(a);
+            }
+        }
+    };
+
+    export template <typename T>
+    inline constexpr rebind_allocator_fn<T> rebind_allocator{};
+
+    export template <typename T, typename A>
+    using rebind_alloc_t = decltype(rebind_allocator<T>(std::declval<A const&>()));
+}
+
+namespace genex::detail {
+    struct arena_buffer {
+        std::unique_ptr<std::byte[]> m_buffer;
+        std::size_t m_capacity;
+    };
+}
+
+namespace genex {
+    /**
+     * A monotonic memory resource for per-request scratch space. Allocations are bump-pointer increments into an
+     * owned buffer of @c capacity bytes (falling back to @c upstream once exhausted), and deallocation is a no-op.
+     * Every temporary of a pipeline that was given this arena is freed at once by @c reset, which rewinds the pointer
+     * to the start of the buffer. Pass it to allocator-aware functions as @c &arena (or via @c allocator<T>()).
+     *
+     * Not thread-safe: use one arena per worker thread, which is also what removes the contention on the global heap.
+     */
+    export class arena : detail::arena_buffer, public std::pmr::monotonic_buffer_resource {
+    public:
+        static constexpr std::size_t default_capacity = 64 * 1024;
+
+        GENEX_INLINE explicit arena(const std::size_t capacity = default_capacity, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource()) :
+            arena_buffer{std::make_unique_for_overwrite<std::byte[]>(capacity), capacity},
+            monotonic_buffer_resource(m_buffer.get(), capacity, upstream) {
+        }
+
+        arena(const arena &) = delete;
+        arena(arena &&) = delete;
+        auto operator=(const arena &) -> arena& = delete;
+        auto operator=(arena &&) -> arena& = delete;
+        ~arena() override = default;
+
+        GENEX_NODISCARD GENEX_INLINE auto capacity() const noexcept -> std::size_t {
+            return m_capacity;
+        }
+
+        GENEX_INLINE auto reset() noexcept -> void {
+            release();
+        }
+
+        template <typename T>
+        GENEX_NODISCARD GENEX_INLINE auto allocator() noexcept -> std::pmr::polymorphic_allocator<T> {
+            return std::pmr::polymorphic_allocator<T>(this);
+        }
+    };
+}
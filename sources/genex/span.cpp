@@ -36,7 +36,7 @@ namespace genex {
         }
 
         template <typename Self>
-        GENEX_NODISCARD GENEX_INLINE constexpr auto data(this Self &&self) noexcept -> T* {
+        GENEX_NODISCARD GENEX_INLINE constexpr auto data(this Self &&self) noexcept -> T const* {
             return self.m_ptr;
         }
 
@@ -61,17 +61,17 @@ namespace genex {
         }
 
         template <typename Self>
-        GENEX_INLINE constexpr auto operator[](this Self &&self, const std::size_t index) noexcept -> T& {
+        GENEX_INLINE constexpr auto operator[](this Self &&self, const std::size_t index) noexcept -> T const& {
             return self.m_ptr[index];
         }
 
         template <typename Self>
-        GENEX_INLINE auto front(this Self &&self) noexcept -> T& {
+        GENEX_INLINE auto front(this Self &&self) noexcept -> T const& {
             return *self.m_ptr;
         }
 
         template <typename Self>
-        GENEX_INLINE auto back(this Self &&self) noexcept -> T& {
+        GENEX_INLINE auto back(this Self &&self) noexcept -> T const& {
             return *(self.m_ptr + self.m_size - 1);
         }
     };
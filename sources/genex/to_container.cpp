@@ -4,6 +4,7 @@ module;
 export module genex.to_container;
 export import genex.pipe;
 import genex.concepts;
+import genex.memory;
 import genex.iterators.access;
 import genex.iterators.iter_pair;
 import std;
@@ -53,6 +54,28 @@ namespace genex {
         return out;
     }
 
+    export template <typename Out, typename Rng, typename Alloc>
+    requires input_range<Rng> and allocator_or_resource<Alloc> and std::constructible_from<Out, rebind_alloc_t<typename Out::value_type, Alloc>>
+    GENEX_INLINE auto to_base_fn(Rng &&rng, Alloc const &alloc) -> Out {
+        auto out = Out(rebind_allocator<typename Out::value_type>(alloc));
+        auto [first, last] = iterators::iter_pair(rng);
+        if constexpr (has_member_size<Rng> and has_member_reserve<Out>) {
+            out.reserve(std::bit_cast<std::size_t>(rng.size()));
+        }
+        for (; first != last; ++first) {
+            // See the note in the `Out<range_value_t<Rng>>` overload above.
+            out.push_back(*first);
+        }
+        return out;
+    }
+
+    export template <template <typename...> typename Out, typename Rng, typename Alloc>
+    requires input_range<Rng> and allocator_or_resource<Alloc> and std::constructible_from<Out<range_value_t<Rng>, rebind_alloc_t<range_value_t<Rng>, Alloc>>, rebind_alloc_t<range_value_t<Rng>, Alloc>>
+    GENEX_INLINE auto to_base_fn(Rng &&rng, Alloc const &alloc) -> Out<range_value_t<Rng>, rebind_alloc_t<range_value_t<Rng>, Alloc>> {
+        using out_t = Out<range_value_t<Rng>, rebind_alloc_t<range_value_t<Rng>, Alloc>>;
+        return to_base_fn<out_t>(std::forward<Rng>(rng), alloc);
+    }
+
     export template <template <typename...> typename Out>
     GENEX_INLINE auto to() -> auto {
         return []<typename Rng> requires input_range<Rng>(Rng &&rng) {
@@ -66,4 +89,55 @@ namespace genex {
             return to_base_fn<Out>(std::forward<Rng>(rng));
         };
     }
+
+    export template <template <typename...> typename Out, typename Alloc>
+    requires allocator_or_resource<Alloc>
+    GENEX_INLINE auto to(Alloc alloc) -> auto {
+        return [alloc]<typename Rng> requires input_range<Rng>(Rng &&rng) {
+            return to_base_fn<Out>(std::forward<Rng>(rng), alloc);
+        };
+    }
+
+    export template <typename Out, typename Alloc>
+    requires allocator_or_resource<Alloc>
+    GENEX_INLINE auto to(Alloc alloc) -> auto {
+        return [alloc]<typename Rng> requires input_range<Rng>(Rng &&rng) {
+            return to_base_fn<Out>(std::forward<Rng>(rng), alloc);
+        };
+    }
+
+    template <template <typename...> typename Out, typename Tup, typename Is = std::make_index_sequence<std::tuple_size_v<Tup>>>
+    struct unzip_out;
+
+    template <template <typename...> typename Out, typename Tup, std::size_t... Is>
+    struct unzip_out<Out, Tup, std::index_sequence<Is...>> {
+        using type = Out<std::tuple_element_t<Is, Tup>...>;
+    };
+
+    /**
+     * Splits a range of tuple-like rows (e.g. the output of @c views::zip, or @c std::pair / @c std::array elements)
+     * into a column-wise container in a single pass: each row is unpacked and its fields are appended to @c Out<Ts...>
+     * with @c emplace_back(fields...), where @c Ts are the row's @c std::tuple_element_t types.
+     */
+    export template <template <typename...> typename Out, typename Rng>
+    requires input_range<Rng> and requires { std::tuple_size<range_value_t<Rng>>::value; }
+    GENEX_INLINE auto unzip_base_fn(Rng &&rng) -> unzip_out<Out, range_value_t<Rng>>::type {
+        using out_t = unzip_out<Out, range_value_t<Rng>>::type;
+        auto out = out_t();
+        auto [first, last] = iterators::iter_pair(rng);
+        if constexpr (has_member_size<Rng> and has_member_reserve<out_t>) {
+            out.reserve(std::bit_cast<std::size_t>(rng.size()));
+        }
+        for (; first != last; ++first) {
+            std::apply([&out]<typename... Args>(Args &&... args) { out.emplace_back(std::forward<Args>(args)...); }, *first);
+        }
+        return out;
+    }
+
+    export template <template <typename...> typename Out>
+    GENEX_INLINE auto unzip_to() -> auto {
+        return []<typename Rng> requires input_range<Rng>(Rng &&rng) {
+            return unzip_base_fn<Out>(std::forward<Rng>(rng));
+        };
+    }
 }
@@ -0,0 +1,190 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.chunk_by;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import genex.span;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename I, typename S, typename Pred>
+    concept chunk_byable_iters =
+        std::forward_iterator<I> and
+        std::sentinel_for<S, I> and
+        std::indirect_binary_predicate<Pred, I, I>;
+
+    template <typename Rng, typename Pred>
+    concept chunk_byable_range =
+        forward_range<Rng> and
+        chunk_byable_iters<iterator_t<Rng>, sentinel_t<Rng>, Pred>;
+
+    template <typename I, typename S, typename Proj>
+    concept adjacent_groupable_iters =
+        std::forward_iterator<I> and
+        std::sentinel_for<S, I> and
+        std::indirectly_regular_unary_invocable<Proj, I> and
+        std::equality_comparable<std::indirect_result_t<Proj&, I>>;
+
+    template <typename Rng, typename Proj>
+    concept adjacent_groupable_range =
+        forward_range<Rng> and
+        adjacent_groupable_iters<iterator_t<Rng>, sentinel_t<Rng>, Proj>;
+}
+
+namespace genex::views::detail::impl {
+    struct chunk_by_sentinel {};
+
+    // Two neighbours belong to the same group when their projected keys are equal.
+    template <typename Proj>
+    struct same_key_pred {
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+
+        template <typename A, typename B>
+        GENEX_INLINE constexpr auto operator()(A &&a, B &&b) const -> bool {
+            return meta::invoke(operations::eq{}, meta::invoke(*proj, std::forward<A>(a)), meta::invoke(*proj, std::forward<B>(b)));
+        }
+    };
+
+    /**
+     * Yields each maximal run of consecutive elements for which @c pred holds between every neighbouring pair, as a
+     * @c genex::span over contiguous sources and a @c std::ranges::subrange of the source iterators otherwise; no
+     * elements are copied. The end of the current group is found once, when the iterator arrives at the group, and
+     * becomes the start of the next one, so every neighbouring pair is compared exactly once however often the
+     * groups are dereferenced.
+     */
+    template <typename I, typename S, typename Pred>
+    requires concepts::chunk_byable_iters<I, S, Pred>
+    struct chunk_by_iterator {
+        I it;
+        I group_end;
+        S st;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Pred> pred;
+
+        using value_type = std::conditional_t<std::contiguous_iterator<I>, genex::span<std::remove_reference_t<iter_reference_t<I>>>, std::ranges::subrange<I>>;
+        using reference_type = value_type;
+        using difference_type = iter_difference_t<I>;
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(chunk_by_iterator)
+
+        GENEX_INLINE constexpr chunk_by_iterator() = default;
+
+        GENEX_INLINE constexpr chunk_by_iterator(I first, S last, Pred pred) :
+            it(first), group_end(std::move(first)), st(std::move(last)), pred(std::move(pred)) {
+            find_group_end();
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            self.it = self.group_end;
+            self.find_group_end();
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            return value_type(self.it, self.group_end);
+        }
+
+        GENEX_VIEW_ITER_EQ(chunk_by_iterator, chunk_by_iterator) {
+            return self.it == that.it;
+        }
+
+        GENEX_VIEW_ITER_EQ(chunk_by_iterator, chunk_by_sentinel) {
+            return self.it == self.st;
+        }
+
+    private:
+        GENEX_INLINE constexpr auto find_group_end() -> void {
+            if (it == st) { return; }
+            auto prev = it;
+            for (group_end = std::ranges::next(it); group_end != st and meta::invoke(*pred, *prev, *group_end); ++group_end) {
+                prev = group_end;
+            }
+        }
+    };
+
+    template <typename I, typename S, typename Pred>
+    requires concepts::chunk_byable_iters<I, S, Pred>
+    struct chunk_by_view {
+        I it;
+        S st;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Pred> pred;
+
+        GENEX_INLINE constexpr chunk_by_view(I first, S last, Pred pred) :
+            it(std::move(first)), st(std::move(last)), pred(std::move(pred)) {
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            return chunk_by_iterator<I, S, Pred>(self.it, self.st, *self.pred);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            return chunk_by_sentinel();
+        }
+    };
+}
+
+namespace genex::views {
+    struct chunk_by_fn {
+        template <typename I, typename S, typename Pred>
+        requires detail::concepts::chunk_byable_iters<I, S, Pred>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Pred pred) const noexcept(
+            SAFE_MOVE(I) and SAFE_MOVE(S) and SAFE_MOVE(Pred)) {
+            return detail::impl::chunk_by_view<I, S, Pred>(std::move(first), std::move(last), std::move(pred));
+        }
+
+        template <typename Rng, typename Pred>
+        requires detail::concepts::chunk_byable_range<Rng, Pred>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Pred pred) const noexcept(
+            SAFE_MOVE(iterator_t<Rng>) and SAFE_MOVE(sentinel_t<Rng>) and SAFE_MOVE(Pred)) {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::chunk_by_view<iterator_t<Rng>, sentinel_t<Rng>, Pred>(std::move(first), std::move(last), std::move(pred));
+        }
+
+        template <typename Pred>
+        requires (not range<Pred>)
+        GENEX_INLINE constexpr auto operator()(Pred pred) const noexcept(
+            SAFE_CTOR(chunk_by_fn) and SAFE_MOVE(Pred)) {
+            return meta::bind_back(chunk_by_fn{}, std::move(pred));
+        }
+    };
+
+    struct group_adjacent_fn {
+        /**
+         * Groups consecutive elements with equal (projected) keys, e.g. the sessions of a click stream sorted by
+         * user. Equivalent to @c chunk_by with a key-equality predicate.
+         */
+        template <typename I, typename S, typename Proj = meta::identity>
+        requires detail::concepts::adjacent_groupable_iters<I, S, Proj>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Proj proj = {}) const noexcept(
+            SAFE_MOVE(I) and SAFE_MOVE(S) and SAFE_MOVE(Proj)) {
+            using pred_t = detail::impl::same_key_pred<Proj>;
+            return detail::impl::chunk_by_view<I, S, pred_t>(std::move(first), std::move(last), pred_t{std::move(proj)});
+        }
+
+        template <typename Rng, typename Proj = meta::identity>
+        requires detail::concepts::adjacent_groupable_range<Rng, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Proj proj = {}) const noexcept(
+            SAFE_MOVE(iterator_t<Rng>) and SAFE_MOVE(sentinel_t<Rng>) and SAFE_MOVE(Proj)) {
+            auto [first, last] = iterators::iter_pair(rng);
+            return (*this)(std::move(first), std::move(last), std::move(proj));
+        }
+
+        template <typename Proj>
+        requires (not range<Proj>)
+        GENEX_INLINE constexpr auto operator()(Proj proj) const noexcept(
+            SAFE_CTOR(group_adjacent_fn) and SAFE_MOVE(Proj)) {
+            return meta::bind_back(group_adjacent_fn{}, std::move(proj));
+        }
+    };
+
+    export inline constexpr chunk_by_fn chunk_by{};
+    export inline constexpr group_adjacent_fn group_adjacent{};
+}
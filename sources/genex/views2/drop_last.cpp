@@ -25,6 +25,97 @@ namespace genex::views::detail::concepts {
         droppable_last_iters<iterator_t<Rng>, sentinel_t<Rng>, Int>;
 }
 
+namespace genex::views::detail::impl {
+    struct drop_last_sentinel {};
+
+    template <typename I, typename S>
+    struct drop_last_ring_view;
+
+    template <typename I, typename S>
+    struct drop_last_ring_iterator {
+        using view_type = drop_last_ring_view<I, S>;
+
+        view_type *view = nullptr;
+
+        using value_type = iter_value_t<I>;
+        using reference_type = value_type&;
+        using difference_type = iter_difference_t<I>;
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(drop_last_ring_iterator)
+
+        GENEX_INLINE constexpr drop_last_ring_iterator() = default;
+
+        GENEX_INLINE constexpr explicit drop_last_ring_iterator(view_type *view) :
+            view(view) {
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            self.view->advance();
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            return self.view->ring[self.view->head];
+        }
+
+        GENEX_VIEW_ITER_EQ(drop_last_ring_iterator, drop_last_sentinel) {
+            return self.view->done;
+        }
+    };
+
+    /**
+     * Single-pass @c drop_last for input ranges: output is delayed by @c n elements through a ring of @c n + 1 slots
+     * holding the current element and the @c n read ahead of it. An element is only yielded once it is known to have
+     * at least @c n successors, so the source is traversed exactly once with O(n) memory.
+     */
+    template <typename I, typename S>
+    struct drop_last_ring_view {
+        I it;
+        S st;
+        std::vector<iter_value_t<I>> ring;
+        std::size_t n;
+        std::size_t head = 0;
+        bool started = false;
+        bool done = false;
+
+        GENEX_INLINE constexpr drop_last_ring_view(I first, S last, const std::size_t n) :
+            it(std::move(first)), st(std::move(last)), n(n) {
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto begin() -> drop_last_ring_iterator<I, S> {
+            if (not started) { prime(); }
+            return drop_last_ring_iterator<I, S>(this);
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto end() noexcept -> drop_last_sentinel {
+            return {};
+        }
+
+        constexpr auto advance() -> void {
+            if (it == st) {
+                done = true;
+                return;
+            }
+            ring[head] = *it;
+            ++it;
+            if (++head == ring.size()) { head = 0; }
+        }
+
+    private:
+        constexpr auto prime() -> void {
+            started = true;
+            ring.reserve(n + 1);
+            for (; ring.size() <= n and it != st; ++it) {
+                ring.emplace_back(*it);
+            }
+            done = ring.size() <= n;
+        }
+    };
+}
+
 namespace genex::views {
     struct drop_last_fn {
         template <typename I, typename S, typename Int>
@@ -43,6 +134,13 @@ namespace genex::views {
             return std::ranges::subrange(std::move(first), iterators::prev(std::move(last), n));
         }
 
+        template <typename I, typename S, typename Int>
+        requires detail::concepts::droppable_last_iters<I, S, Int> and (not std::forward_iterator<I>)
+        GENEX_INLINE constexpr auto operator()(I first, S last, const Int n) const noexcept(
+            SAFE_MOVE(I) and SAFE_MOVE(S) and SAFE_MOVE(Int)) {
+            return detail::impl::drop_last_ring_view<I, S>(std::move(first), std::move(last), static_cast<std::size_t>(n));
+        }
+
         template <typename I, typename S, typename Int>
         requires detail::concepts::droppable_last_iters<I, S, Int>
         GENEX_INLINE constexpr auto operator()(I first, S last, const Int n) const noexcept(
@@ -69,6 +167,14 @@ namespace genex::views {
             return std::ranges::subrange(std::move(first), iterators::prev(std::move(last), n));
         }
 
+        template <typename Rng, typename Int>
+        requires detail::concepts::droppable_last_range<Rng, Int> and (not std::forward_iterator<iterator_t<Rng>>)
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, const Int n) const noexcept(
+            SAFE_MOVE(iterator_t<Rng>) and SAFE_MOVE(sentinel_t<Rng>) and SAFE_MOVE(Int)) {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::drop_last_ring_view<iterator_t<Rng>, sentinel_t<Rng>>(std::move(first), std::move(last), static_cast<std::size_t>(n));
+        }
+
         template <typename Rng, typename Int>
         requires detail::concepts::droppable_last_range<Rng, Int>
         GENEX_INLINE constexpr auto operator()(Rng &&rng, const Int n) const noexcept(
@@ -4,6 +4,7 @@ module;
 export module genex.views2.duplicates;
 export import genex.pipe;
 import genex.concepts;
+import genex.memory;
 import genex.meta;
 import genex.iterators.iter_pair;
 import genex.operations.cmp;
@@ -25,7 +26,7 @@ namespace genex::views::detail::concepts {
 namespace genex::views::detail::impl {
     struct duplicate_sentinel {};
 
-    template <typename I, typename S, typename Comp, typename Proj>
+    template <typename I, typename S, typename Comp, typename Proj, typename Alloc = std::allocator<iter_value_t<I>>>
     requires concepts::duplicate_checkable_iters<I, S, Comp, Proj>
     struct duplicate_iterator {
         I it;
@@ -34,7 +35,7 @@ namespace genex::views::detail::impl {
         GENEX_NO_UNIQUE_ADDRESS Proj proj;
 
         // Duplicate state attributes
-        std::vector<iter_value_t<I>> seen;
+        std::vector<iter_value_t<I>, Alloc> seen;
         std::optional<iter_value_t<I>> dupe_elem;
         std::optional<iter_value_t<I>> pending;
         std::optional<iter_value_t<I>> cur_elem;
@@ -48,9 +49,9 @@ namespace genex::views::detail::impl {
 
         GENEX_INLINE constexpr duplicate_iterator() = default;
 
-        GENEX_INLINE constexpr duplicate_iterator(I first, S last, Comp comp, Proj proj) :
+        GENEX_INLINE constexpr duplicate_iterator(I first, S last, Comp comp, Proj proj, Alloc alloc = {}) :
             it(std::move(first)), st(std::move(last)),
-            comp(std::move(comp)), proj(std::move(proj)) {
+            comp(std::move(comp)), proj(std::move(proj)), seen(std::move(alloc)) {
             fwd_to_valid();
         }
 
@@ -118,22 +119,23 @@ namespace genex::views::detail::impl {
         }
     };
 
-    template <typename I, typename S, typename Comp, typename Proj>
+    template <typename I, typename S, typename Comp, typename Proj, typename Alloc = std::allocator<iter_value_t<I>>>
     requires concepts::duplicate_checkable_iters<I, S, Comp, Proj>
     struct duplicate_view {
         I it;
         S st;
         GENEX_NO_UNIQUE_ADDRESS Comp comp;
         GENEX_NO_UNIQUE_ADDRESS Proj proj;
+        GENEX_NO_UNIQUE_ADDRESS Alloc alloc;
 
-        GENEX_INLINE constexpr duplicate_view(I first, S last, Comp comp, Proj proj = {}) :
+        GENEX_INLINE constexpr duplicate_view(I first, S last, Comp comp, Proj proj = {}, Alloc alloc = {}) :
             it(std::move(first)), st(std::move(last)),
-            comp(std::move(comp)), proj(std::move(proj)) {
+            comp(std::move(comp)), proj(std::move(proj)), alloc(std::move(alloc)) {
         }
 
         template <typename Self>
         GENEX_ITER_BEGIN {
-            return duplicate_iterator(self.it, self.st, self.comp, self.proj);
+            return duplicate_iterator<I, S, Comp, Proj, Alloc>(self.it, self.st, self.comp, self.proj, self.alloc);
         }
 
         template <typename Self>
@@ -162,6 +164,30 @@ namespace genex::views {
             return detail::impl::duplicate_view(std::move(first), std::move(last), std::move(comp), std::move(proj));
         }
 
+        template <typename I, typename S, typename Comp = operations::eq, typename Proj = meta::identity, typename Alloc>
+        requires detail::concepts::duplicate_checkable_iters<I, S, Comp, Proj> and allocator_or_resource<Alloc>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Comp comp, Proj proj, Alloc const &alloc) const {
+            using alloc_t = rebind_alloc_t<iter_value_t<I>, Alloc>;
+            return detail::impl::duplicate_view<I, S, Comp, Proj, alloc_t>(
+                std::move(first), std::move(last), std::move(comp), std::move(proj), rebind_allocator<iter_value_t<I>>(alloc));
+        }
+
+        template <typename Rng, typename Comp = operations::eq, typename Proj = meta::identity, typename Alloc>
+        requires detail::concepts::duplicate_checkable_range<Rng, Comp, Proj> and allocator_or_resource<Alloc>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Comp comp, Proj proj, Alloc const &alloc) const {
+            using alloc_t = rebind_alloc_t<range_value_t<Rng>, Alloc>;
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::duplicate_view<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj, alloc_t>(
+                std::move(first), std::move(last), std::move(comp), std::move(proj), rebind_allocator<range_value_t<Rng>>(alloc));
+        }
+
+        template <typename Comp = operations::eq, typename Proj = meta::identity, typename Alloc>
+        requires (not range<Comp> and allocator_or_resource<Alloc>)
+        GENEX_INLINE constexpr auto operator()(Comp comp, Proj proj, Alloc alloc) const noexcept(
+            SAFE_CTOR(duplicates_fn) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj) and SAFE_MOVE(Alloc)) {
+            return meta::bind_back(duplicates_fn{}, std::move(comp), std::move(proj), std::move(alloc));
+        }
+
         template <typename Comp = operations::eq, typename Proj = meta::identity>
         requires (not range<Comp>)
         GENEX_INLINE constexpr auto operator()(Comp comp = {}, Proj proj = {}) const noexcept(
@@ -0,0 +1,259 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.hash_join;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename I1, typename S1, typename I2, typename S2, typename BuildKey, typename ProbeKey>
+    concept hash_joinable_iters =
+        std::forward_iterator<I1> and
+        std::sentinel_for<S1, I1> and
+        std::input_iterator<I2> and
+        std::sentinel_for<S2, I2> and
+        std::indirectly_regular_unary_invocable<BuildKey, I1> and
+        std::indirectly_regular_unary_invocable<ProbeKey, I2> and
+        std::equality_comparable_with<std::indirect_result_t<BuildKey&, I1>, std::indirect_result_t<ProbeKey&, I2>> and
+        std::default_initializable<std::hash<std::remove_cvref_t<std::indirect_result_t<BuildKey&, I1>>>> and
+        std::invocable<std::hash<std::remove_cvref_t<std::indirect_result_t<BuildKey&, I1>>> const&, std::indirect_result_t<BuildKey&, I1>> and
+        std::invocable<std::hash<std::remove_cvref_t<std::indirect_result_t<BuildKey&, I1>>> const&, std::indirect_result_t<ProbeKey&, I2>>;
+
+    template <typename T>
+    concept reference_wrapped = not std::same_as<std::unwrap_reference_t<std::remove_cvref_t<T>>, std::remove_cvref_t<T>>;
+
+    // The probe side may be passed as a std::reference_wrapper, so that the pipe form can refer to the caller's range.
+    template <typename Rng>
+    using probe_range_t = std::conditional_t<reference_wrapped<Rng>, std::unwrap_reference_t<std::remove_cvref_t<Rng>>, Rng>;
+
+    template <typename Rng1, typename Rng2, typename BuildKey, typename ProbeKey>
+    concept hash_joinable_range =
+        forward_range<Rng1> and
+        input_range<probe_range_t<Rng2>> and
+        hash_joinable_iters<iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<probe_range_t<Rng2>>, sentinel_t<probe_range_t<Rng2>>, BuildKey, ProbeKey>;
+}
+
+namespace genex::views::detail::impl {
+    // Inner joins yield every matching (build, probe) pair; semi and anti joins yield each probe element at most once,
+    // depending on whether it has any match on the build side.
+    enum class join_mode { inner, semi, anti };
+
+    struct hash_join_sentinel {};
+
+    template <typename Rng>
+    GENEX_INLINE constexpr auto unwrap_probe(Rng &rng) noexcept -> auto& {
+        if constexpr (concepts::reference_wrapped<Rng>) { return rng.get(); }
+        else { return rng; }
+    }
+
+    inline constexpr std::size_t hash_join_npos = std::numeric_limits<std::size_t>::max();
+
+    template <join_mode Mode, typename I1, typename S1, typename I2, typename S2, typename BuildKey, typename ProbeKey>
+    struct hash_join_view;
+
+    template <join_mode Mode, typename I1, typename S1, typename I2, typename S2, typename BuildKey, typename ProbeKey>
+    struct hash_join_iterator {
+        using view_type = hash_join_view<Mode, I1, S1, I2, S2, BuildKey, ProbeKey>;
+
+        view_type *view = nullptr;
+        I2 it;
+        S2 st;
+        std::size_t match = hash_join_npos;
+
+        using value_type = std::conditional_t<Mode == join_mode::inner, std::pair<iter_value_t<I1>, iter_value_t<I2>>, iter_value_t<I2>>;
+        using reference_type = std::conditional_t<Mode == join_mode::inner, std::pair<iter_reference_t<I1>, iter_reference_t<I2>>, iter_reference_t<I2>>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<std::forward_iterator<I2>, std::forward_iterator_tag, std::input_iterator_tag>;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(hash_join_iterator)
+
+        GENEX_INLINE constexpr hash_join_iterator() = default;
+
+        GENEX_INLINE constexpr hash_join_iterator(view_type *view, I2 first, S2 last) :
+            view(view), it(std::move(first)), st(std::move(last)) {
+            fwd_to_valid();
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            if constexpr (Mode == join_mode::inner) {
+                self.match = self.view->next[self.match];
+                if (self.match != hash_join_npos) { return self; }
+            }
+            ++self.it;
+            self.fwd_to_valid();
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            if constexpr (Mode == join_mode::inner) {
+                return reference_type(*self.view->rows[self.match], *self.it);
+            }
+            else {
+                return static_cast<reference_type>(*self.it);
+            }
+        }
+
+        GENEX_VIEW_ITER_EQ(hash_join_iterator, hash_join_iterator) {
+            return self.it == that.it and self.match == that.match;
+        }
+
+        GENEX_VIEW_ITER_EQ(hash_join_iterator, hash_join_sentinel) {
+            return self.it == self.st;
+        }
+
+    private:
+        GENEX_INLINE constexpr auto fwd_to_valid() -> void {
+            for (; it != st; ++it) {
+                match = view->lookup(*it);
+                if constexpr (Mode == join_mode::anti) {
+                    if (match == hash_join_npos) { return; }
+                }
+                else {
+                    if (match != hash_join_npos) { return; }
+                }
+            }
+            match = hash_join_npos;
+        }
+    };
+
+    /**
+     * Builds a flat hash multimap over the build side on the first call to @c begin, then streams the probe side
+     * through it. The table stores no keys or copies: the build elements are referenced through a vector of their
+     * iterators, equal keys are chained through a parallel @c next array (in build order), and an open-addressed slot
+     * array (at most half full, linear probing) maps each distinct key's hash to the head of its chain. A probe is one
+     * hash, usually one slot, and one key comparison; its matches are then walked without further hashing.
+     */
+    template <join_mode Mode, typename I1, typename S1, typename I2, typename S2, typename BuildKey, typename ProbeKey>
+    struct hash_join_view {
+        using key_type = std::remove_cvref_t<std::indirect_result_t<BuildKey&, I1>>;
+
+        struct slot {
+            std::size_t hash;
+            std::size_t head = hash_join_npos;
+        };
+
+        I1 first1;
+        S1 last1;
+        I2 first2;
+        S2 last2;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<BuildKey> build_key;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<ProbeKey> probe_key;
+        GENEX_NO_UNIQUE_ADDRESS std::hash<key_type> hasher;
+        std::vector<I1> rows;
+        std::vector<std::size_t> next;
+        std::vector<slot> slots;
+        int shift = 64;
+        bool built = false;
+
+        GENEX_INLINE constexpr hash_join_view(I1 f1, S1 l1, I2 f2, S2 l2, BuildKey bk, ProbeKey pk) :
+            first1(std::move(f1)), last1(std::move(l1)), first2(std::move(f2)), last2(std::move(l2)),
+            build_key(std::move(bk)), probe_key(std::move(pk)) {
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto begin() -> hash_join_iterator<Mode, I1, S1, I2, S2, BuildKey, ProbeKey> {
+            if (not built) { build(); }
+            return hash_join_iterator<Mode, I1, S1, I2, S2, BuildKey, ProbeKey>(this, first2, last2);
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto end() noexcept -> hash_join_sentinel {
+            return {};
+        }
+
+        /**
+         * The first build row whose key equals the probe element's key, or @c hash_join_npos if there is none.
+         */
+        template <typename V>
+        GENEX_INLINE auto lookup(V &&v) const -> std::size_t {
+            if (rows.empty()) { return hash_join_npos; }
+            decltype(auto) key = meta::invoke(*probe_key, std::forward<V>(v));
+            const auto h = static_cast<std::size_t>(hasher(key));
+            for (auto i = home(h);; i = (i + 1) & (slots.size() - 1)) {
+                auto const &s = slots[i];
+                if (s.head == hash_join_npos) { return hash_join_npos; }
+                if (s.hash == h and meta::invoke(*build_key, *rows[s.head]) == key) { return s.head; }
+            }
+        }
+
+    private:
+        // Fibonacci hashing: the top bits of the product depend on every bit of the hash, so identity hashes of
+        // regularly spaced integers still spread over the table.
+        GENEX_INLINE auto home(const std::size_t h) const noexcept -> std::size_t {
+            return static_cast<std::size_t>((static_cast<std::uint64_t>(h) * 0x9e3779b97f4a7c15ull) >> shift);
+        }
+
+        auto build() -> void {
+            built = true;
+            for (auto it = first1; it != last1; ++it) { rows.push_back(it); }
+            const auto n = rows.size();
+            if (n == 0) { return; }
+
+            const auto capacity = std::bit_ceil(std::max(2 * n, 16uz));
+            shift = 64 - std::countr_zero(capacity);
+            slots.assign(capacity, slot{});
+            next.assign(n, hash_join_npos);
+
+            // Rows are inserted back to front and pushed onto the head of their key's chain, leaving each chain in
+            // build order.
+            for (auto r = n; r-- > 0;) {
+                decltype(auto) key = meta::invoke(*build_key, *rows[r]);
+                const auto h = static_cast<std::size_t>(hasher(key));
+                auto i = home(h);
+                while (slots[i].head != hash_join_npos and not (slots[i].hash == h and meta::invoke(*build_key, *rows[slots[i].head]) == key)) {
+                    i = (i + 1) & (capacity - 1);
+                }
+                next[r] = slots[i].head;
+                slots[i] = slot{h, r};
+            }
+        }
+    };
+}
+
+namespace genex::views {
+    template <detail::impl::join_mode Mode>
+    struct hash_join_base_fn {
+        template <typename I1, typename S1, typename I2, typename S2, typename BuildKey = meta::identity, typename ProbeKey = meta::identity>
+        requires detail::concepts::hash_joinable_iters<I1, S1, I2, S2, BuildKey, ProbeKey>
+        GENEX_INLINE constexpr auto operator()(I1 first1, S1 last1, I2 first2, S2 last2, BuildKey build_key = {}, ProbeKey probe_key = {}) const noexcept(
+            SAFE_MOVE(I1) and SAFE_MOVE(S1) and SAFE_MOVE(I2) and SAFE_MOVE(S2) and SAFE_MOVE(BuildKey) and SAFE_MOVE(ProbeKey)) {
+            return detail::impl::hash_join_view<Mode, I1, S1, I2, S2, BuildKey, ProbeKey>(
+                std::move(first1), std::move(last1), std::move(first2), std::move(last2), std::move(build_key), std::move(probe_key));
+        }
+
+        template <typename Rng1, typename Rng2, typename BuildKey = meta::identity, typename ProbeKey = meta::identity>
+        requires detail::concepts::hash_joinable_range<Rng1, Rng2, BuildKey, ProbeKey>
+        GENEX_INLINE constexpr auto operator()(Rng1 &&rng1, Rng2 &&rng2, BuildKey build_key = {}, ProbeKey probe_key = {}) const noexcept(
+            SAFE_MOVE(BuildKey) and SAFE_MOVE(ProbeKey)) {
+            using probe_t = detail::concepts::probe_range_t<Rng2>;
+            auto [first1, last1] = iterators::iter_pair(rng1);
+            auto [first2, last2] = iterators::iter_pair(detail::impl::unwrap_probe(rng2));
+            return detail::impl::hash_join_view<Mode, iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<probe_t>, sentinel_t<probe_t>, BuildKey, ProbeKey>(
+                std::move(first1), std::move(last1), std::move(first2), std::move(last2), std::move(build_key), std::move(probe_key));
+        }
+
+        /**
+         * Binds the probe side for use as @c build | hash_join(probe, ...). As with every bound argument, @c rng2 is
+         * copied into the returned closure and lives only as long as it; pass @c std::ref(probe) to join against the
+         * caller's range itself, e.g. to keep the view or to write through the yielded probe references.
+         */
+        template <typename Rng2, typename BuildKey = meta::identity, typename ProbeKey = meta::identity>
+        requires (input_range<detail::concepts::probe_range_t<Rng2>> and not range<BuildKey>)
+        GENEX_INLINE constexpr auto operator()(Rng2 &&rng2, BuildKey build_key = {}, ProbeKey probe_key = {}) const noexcept(
+            SAFE_CTOR(hash_join_base_fn) and SAFE_MOVE(Rng2) and SAFE_MOVE(BuildKey) and SAFE_MOVE(ProbeKey)) {
+            return meta::bind_back(hash_join_base_fn{}, std::forward<Rng2>(rng2), std::move(build_key), std::move(probe_key));
+        }
+    };
+
+    using hash_join_fn = hash_join_base_fn<detail::impl::join_mode::inner>;
+    using hash_semi_join_fn = hash_join_base_fn<detail::impl::join_mode::semi>;
+    using hash_anti_join_fn = hash_join_base_fn<detail::impl::join_mode::anti>;
+
+    export inline constexpr hash_join_fn hash_join{};
+    export inline constexpr hash_semi_join_fn hash_semi_join{};
+    export inline constexpr hash_anti_join_fn hash_anti_join{};
+}
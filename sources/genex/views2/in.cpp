@@ -25,6 +25,34 @@ namespace genex::views::detail::concepts {
         input_range<Rng1> and
         forward_range<Rng2> and
         inable_iters<iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<Rng2>, sentinel_t<Rng2>, Proj1, Proj2>;
+
+    template <typename Idx>
+    using index_t = std::remove_cvref_t<std::unwrap_reference_t<std::remove_cvref_t<Idx>>>;
+
+    // A search structure (e.g. an eytzinger_index) probed through its own contains rather than scanned as a range.
+    template <typename Idx>
+    concept membership_index =
+        not range<index_t<Idx>> and
+        requires { typename index_t<Idx>::key_type; };
+
+    template <typename Idx, typename V>
+    concept membership_index_for =
+        membership_index<Idx> and
+        requires(index_t<Idx> const &idx, V &&v) {
+            { idx.contains(std::forward<V>(v)) } -> std::convertible_to<bool>;
+        };
+
+    template <typename I1, typename S1, typename Idx, typename Proj1>
+    concept index_inable_iters =
+        std::input_iterator<I1> and
+        std::sentinel_for<S1, I1> and
+        std::indirectly_regular_unary_invocable<Proj1, I1> and
+        membership_index_for<Idx, std::indirect_result_t<Proj1&, I1>>;
+
+    template <typename Rng1, typename Idx, typename Proj1>
+    concept index_inable_range =
+        input_range<Rng1> and
+        index_inable_iters<iterator_t<Rng1>, sentinel_t<Rng1>, Idx, Proj1>;
 }
 
 namespace genex::views::detail::impl {
@@ -41,6 +69,18 @@ namespace genex::views::detail::impl {
             else { return found; }
         }
     };
+
+    template <bool Negate, typename Idx>
+    struct index_membership_pred {
+        Idx const *index;
+
+        template <typename V>
+        GENEX_INLINE constexpr auto operator()(V &&v) const -> bool {
+            const auto found = static_cast<bool>(index->contains(std::forward<V>(v)));
+            if constexpr (Negate) { return not found; }
+            else { return found; }
+        }
+    };
 }
 
 namespace genex::views {
@@ -65,8 +105,37 @@ namespace genex::views {
             return genex::views::filter(std::move(first1), std::move(last1), std::move(pred), std::move(proj1));
         }
 
+        /**
+         * Probes a search index (such as @c genex::eytzinger_index) instead of scanning a range. The index is held
+         * by reference and must outlive the view.
+         */
+        template <typename I1, typename S1, typename Idx, typename Proj1 = meta::identity>
+        requires detail::concepts::index_inable_iters<I1, S1, Idx, Proj1>
+        GENEX_INLINE constexpr auto operator()(I1 first1, S1 last1, Idx const &index, Proj1 proj1 = {}) const noexcept(
+            SAFE_MOVE(I1) and SAFE_MOVE(S1) and SAFE_MOVE(Proj1)) {
+            using index_type = detail::concepts::index_t<Idx>;
+            index_type const &idx = index;
+            auto pred = detail::impl::index_membership_pred<Negate, index_type>{std::addressof(idx)};
+            return genex::views::filter(std::move(first1), std::move(last1), std::move(pred), std::move(proj1));
+        }
+
+        template <typename Rng1, typename Idx, typename Proj1 = meta::identity>
+        requires detail::concepts::index_inable_range<Rng1, Idx, Proj1>
+        GENEX_INLINE constexpr auto operator()(Rng1 &&rng1, Idx const &index, Proj1 proj1 = {}) const noexcept(
+            SAFE_MOVE(Rng1) and SAFE_MOVE(Proj1)) {
+            auto [first1, last1] = iterators::iter_pair(rng1);
+            return (*this)(std::move(first1), std::move(last1), index, std::move(proj1));
+        }
+
+        template <typename Idx, typename Proj1 = meta::identity>
+        requires (detail::concepts::membership_index<Idx> and not range<Proj1>)
+        GENEX_INLINE constexpr auto operator()(Idx const &index, Proj1 proj1 = {}) const noexcept(
+            SAFE_CTOR(in_base_fn<Negate>) and SAFE_MOVE(Proj1)) {
+            return meta::bind_back(in_base_fn{}, std::cref(static_cast<detail::concepts::index_t<Idx> const&>(index)), std::move(proj1));
+        }
+
         template <typename Rng2, typename Proj1 = meta::identity, typename Proj2 = meta::identity>
-        requires (forward_range<Rng2> and not range<Proj1>)
+        requires (forward_range<Rng2> and not range<Proj1> and not detail::concepts::membership_index<Proj1>)
         GENEX_INLINE constexpr auto operator()(Rng2 &&rng2, Proj1 proj1 = {}, Proj2 proj2 = {}) const noexcept(
             SAFE_CTOR(in_base_fn<Negate>) and
             SAFE_MOVE(Rng2) and SAFE_MOVE(Proj1) and SAFE_MOVE(Proj2)) {
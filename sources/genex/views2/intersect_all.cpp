@@ -0,0 +1,338 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.intersect_all;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.algorithms.search_primitives;
+import genex.iterators.access;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename Comp, typename Proj, typename... Rngs>
+    concept intersectable_all_range =
+        sizeof...(Rngs) > 0 and
+        (input_range<Rngs> and ...) and
+        requires { typename std::common_reference_t<range_reference_t<Rngs>...>; } and
+        std::copyable<std::remove_cvref_t<std::invoke_result_t<Proj&, std::common_reference_t<range_reference_t<Rngs>...>>>> and
+        (std::indirect_strict_weak_order<Comp, std::projected<iterator_t<Rngs>, Proj>> and ...);
+
+    template <typename Rng, typename Comp, typename Proj>
+    concept intersectable_all_nested_range =
+        input_range<Rng> and
+        std::is_lvalue_reference_v<range_reference_t<Rng>> and
+        intersectable_all_range<Comp, Proj, range_reference_t<Rng>>;
+}
+
+namespace genex::views::detail::impl {
+    /**
+     * Leapfrog intersection: the key of the first list in @c order is the candidate, and each list in turn gallops to
+     * its first element not below it. A list landing past the candidate raises it, and the round restarts from there;
+     * once every list agrees, all heads are equal. Seeking from the rarest list first means the candidate mostly jumps
+     * in large strides through the dense lists, so the cost follows the smallest list rather than the total size.
+     *
+     * @c seek(i, key) advances list @c i and returns false when it runs out; @c key_at(i) projects its head.
+     */
+    template <typename Key, typename Comp, typename Exhausted, typename Seek, typename KeyAt>
+    constexpr auto leapfrog(std::span<const std::size_t> order, Comp &comp, Exhausted &&exhausted, Seek &&seek, KeyAt &&key_at) -> bool {
+        const auto n = order.size();
+        if (n == 0 or exhausted(order[0])) { return false; }
+
+        auto key = Key(key_at(order[0]));
+        auto agree = 1uz;
+        for (auto pos = 1 % n; agree < n; pos = (pos + 1) % n) {
+            const auto i = order[pos];
+            if (not seek(i, key)) { return false; }
+            auto head = Key(key_at(i));
+            if (meta::invoke(comp, key, head)) {
+                key = std::move(head);
+                agree = 1;
+            }
+            else {
+                ++agree;
+            }
+        }
+        return true;
+    }
+
+    // Positions the lists so that the smallest one leads, when all sizes are known up front.
+    template <std::size_t N, typename Sizes>
+    constexpr auto rarest_first(Sizes &&sizes) -> std::conditional_t<N == std::dynamic_extent, std::vector<std::size_t>, std::array<std::size_t, N>> {
+        auto order = std::conditional_t<N == std::dynamic_extent, std::vector<std::size_t>, std::array<std::size_t, N>>();
+        if constexpr (N == std::dynamic_extent) { order.resize(sizes.size()); }
+        std::iota(order.begin(), order.end(), 0uz);
+        std::ranges::stable_sort(order, {}, [&sizes](const std::size_t i) { return sizes[i]; });
+        return order;
+    }
+
+    struct intersect_all_sentinel {};
+
+    template <typename Comp, typename Proj, typename... Rngs>
+    requires concepts::intersectable_all_range<Comp, Proj, Rngs...>
+    struct intersect_all_iterator {
+        static constexpr std::size_t k = sizeof...(Rngs);
+
+        std::tuple<iterator_t<Rngs>...> its;
+        std::tuple<sentinel_t<Rngs>...> sts;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+        std::array<std::size_t, k> order{};
+        bool done = true;
+
+        using value_type = std::common_type_t<range_value_t<Rngs>...>;
+        using reference_type = std::common_reference_t<range_reference_t<Rngs>...>;
+        using key_type = std::remove_cvref_t<std::invoke_result_t<Proj&, reference_type>>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<(forward_range<Rngs> and ...), std::forward_iterator_tag, std::input_iterator_tag>;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(intersect_all_iterator)
+
+        GENEX_INLINE constexpr intersect_all_iterator() = default;
+
+        GENEX_INLINE constexpr intersect_all_iterator(std::tuple<iterator_t<Rngs>...> its, std::tuple<sentinel_t<Rngs>...> sts, Comp comp, Proj proj) :
+            its(std::move(its)), sts(std::move(sts)), comp(std::move(comp)), proj(std::move(proj)) {
+            if constexpr ((std::sized_sentinel_for<sentinel_t<Rngs>, iterator_t<Rngs>> and ...)) {
+                const auto sizes = [this]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    return std::array{static_cast<std::size_t>(std::get<Is>(this->sts) - std::get<Is>(this->its))...};
+                }(std::index_sequence_for<Rngs...>{});
+                order = rarest_first<k>(sizes);
+            }
+            else {
+                std::iota(order.begin(), order.end(), 0uz);
+            }
+            fwd_to_valid();
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            std::apply([](auto &... it) { (++it, ...); }, self.its);
+            self.fwd_to_valid();
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            return static_cast<reference_type>(*std::get<0>(self.its));
+        }
+
+        GENEX_VIEW_ITER_EQ(intersect_all_iterator, intersect_all_iterator) {
+            return self.its == that.its and self.done == that.done;
+        }
+
+        GENEX_VIEW_ITER_EQ(intersect_all_iterator, intersect_all_sentinel) {
+            return self.done;
+        }
+
+    private:
+        // Calls `f(it, st)` on the list selected at runtime.
+        template <typename F>
+        GENEX_INLINE constexpr auto visit_at(const std::size_t i, F &&f) -> bool {
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                auto result = false;
+                ((Is == i and (result = f(std::get<Is>(its), std::get<Is>(sts)), true)) or ...);
+                return result;
+            }(std::index_sequence_for<Rngs...>{});
+        }
+
+        GENEX_INLINE constexpr auto fwd_to_valid() -> void {
+            auto key_at = [this](const std::size_t i) {
+                auto key = std::optional<key_type>();
+                visit_at(i, [&](auto &it, auto &) { key.emplace(meta::invoke(*proj, *it)); return true; });
+                return std::move(*key);
+            };
+            auto exhausted = [this](const std::size_t i) {
+                return visit_at(i, [](auto &it, auto &st) { return it == st; });
+            };
+            auto seek = [this](const std::size_t i, key_type const &key) {
+                return visit_at(i, [&](auto &it, auto &st) {
+                    auto below = [&](auto const &elem) { return meta::invoke(*comp, meta::invoke(*proj, elem), key); };
+                    if (it != st and below(*it)) { it = algorithms::detail::impl::gallop(std::move(it), st, below); }
+                    return it != st;
+                });
+            };
+            done = not leapfrog<key_type>(std::span<const std::size_t>(order), *comp, exhausted, seek, key_at);
+        }
+    };
+
+    template <typename Comp, typename Proj, typename... Rngs>
+    requires concepts::intersectable_all_range<Comp, Proj, Rngs...>
+    struct intersect_all_view {
+        std::tuple<iterator_t<Rngs>...> its;
+        std::tuple<sentinel_t<Rngs>...> sts;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+
+        GENEX_INLINE constexpr intersect_all_view(std::tuple<iterator_t<Rngs>...> its, std::tuple<sentinel_t<Rngs>...> sts, Comp comp, Proj proj) :
+            its(std::move(its)), sts(std::move(sts)), comp(std::move(comp)), proj(std::move(proj)) {
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            return intersect_all_iterator<Comp, Proj, Rngs...>(self.its, self.sts, *self.comp, *self.proj);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            return intersect_all_sentinel();
+        }
+    };
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct intersect_all_nested_iterator {
+        std::vector<std::pair<I, S>> heads;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+        std::vector<std::size_t> order;
+        bool done = true;
+
+        using value_type = iter_value_t<I>;
+        using reference_type = iter_reference_t<I>;
+        using key_type = std::remove_cvref_t<std::invoke_result_t<Proj&, reference_type>>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<std::forward_iterator<I>, std::forward_iterator_tag, std::input_iterator_tag>;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(intersect_all_nested_iterator)
+
+        GENEX_INLINE constexpr intersect_all_nested_iterator() = default;
+
+        GENEX_INLINE constexpr intersect_all_nested_iterator(std::vector<std::pair<I, S>> heads, Comp comp, Proj proj) :
+            heads(std::move(heads)), comp(std::move(comp)), proj(std::move(proj)) {
+            if constexpr (std::sized_sentinel_for<S, I>) {
+                auto sizes = std::vector<std::size_t>();
+                sizes.reserve(this->heads.size());
+                for (auto const &[it, st] : this->heads) { sizes.push_back(static_cast<std::size_t>(st - it)); }
+                order = rarest_first<std::dynamic_extent>(sizes);
+            }
+            else {
+                order.resize(this->heads.size());
+                std::iota(order.begin(), order.end(), 0uz);
+            }
+            fwd_to_valid();
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            for (auto &[it, st] : self.heads) { ++it; }
+            self.fwd_to_valid();
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            return *self.heads.front().first;
+        }
+
+        GENEX_VIEW_ITER_EQ(intersect_all_nested_iterator, intersect_all_nested_iterator) {
+            return self.done == that.done and std::ranges::equal(self.heads, that.heads, {}, &std::pair<I, S>::first, &std::pair<I, S>::first);
+        }
+
+        GENEX_VIEW_ITER_EQ(intersect_all_nested_iterator, intersect_all_sentinel) {
+            return self.done;
+        }
+
+    private:
+        GENEX_INLINE constexpr auto fwd_to_valid() -> void {
+            auto key_at = [this](const std::size_t i) -> key_type {
+                return meta::invoke(*proj, *heads[i].first);
+            };
+            auto exhausted = [this](const std::size_t i) {
+                return heads[i].first == heads[i].second;
+            };
+            auto seek = [this](const std::size_t i, key_type const &key) {
+                auto &[it, st] = heads[i];
+                auto below = [&](auto const &elem) { return meta::invoke(*comp, meta::invoke(*proj, elem), key); };
+                if (it != st and below(*it)) { it = algorithms::detail::impl::gallop(std::move(it), st, below); }
+                return it != st;
+            };
+            done = not leapfrog<key_type>(std::span<const std::size_t>(order), *comp, exhausted, seek, key_at);
+        }
+    };
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct intersect_all_nested_view {
+        using inner_t = iter_reference_t<I>;
+
+        std::vector<std::pair<iterator_t<inner_t>, sentinel_t<inner_t>>> heads;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+
+        GENEX_INLINE constexpr intersect_all_nested_view(I first, S last, Comp comp, Proj proj) :
+            comp(std::move(comp)), proj(std::move(proj)) {
+            for (; first != last; ++first) {
+                auto &inner = *first;
+                heads.emplace_back(iterators::iter_pair(inner));
+            }
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            return intersect_all_nested_iterator<iterator_t<inner_t>, sentinel_t<inner_t>, Comp, Proj>(self.heads, *self.comp, *self.proj);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            return intersect_all_sentinel();
+        }
+    };
+}
+
+namespace genex::views {
+    struct intersect_all_fn {
+        /**
+         * Lazily intersects any number of sorted ranges, yielding elements of the first range. The ranges come first,
+         * optionally followed by the comparator they are sorted by and a projection, as with @c views::merge. Each
+         * value appears as many times as its smallest multiplicity across the ranges, as with chained
+         * @c set_intersection.
+         */
+        template <typename... Args>
+        requires (leading_ranges<Args...>() >= 2 and sizeof...(Args) - leading_ranges<Args...>() <= 2)
+        GENEX_INLINE constexpr auto operator()(Args &&... args) const {
+            constexpr auto n = leading_ranges<Args...>();
+            auto all = std::forward_as_tuple(std::forward<Args>(args)...);
+            auto comp = [&] {
+                if constexpr (sizeof...(Args) > n) { return std::get<n>(all); }
+                else { return operations::lt{}; }
+            }();
+            auto proj = [&] {
+                if constexpr (sizeof...(Args) > n + 1) { return std::get<n + 1>(all); }
+                else { return meta::identity{}; }
+            }();
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return make_view(std::move(comp), std::move(proj), std::get<Is>(std::move(all))...);
+            }(std::make_index_sequence<n>{});
+        }
+
+        /**
+         * Intersects a range of sorted ranges whose count is only known at runtime, such as the posting lists of a
+         * query's terms. The inner ranges are referenced, so the outer range must yield lvalues that outlive the view.
+         */
+        template <typename Rng, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires detail::concepts::intersectable_all_nested_range<Rng, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Comp comp = {}, Proj proj = {}) const {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::intersect_all_nested_view<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj>(std::move(first), std::move(last), std::move(comp), std::move(proj));
+        }
+
+        template <typename Comp = operations::lt, typename Proj = meta::identity>
+        requires (not range<Comp>)
+        GENEX_INLINE constexpr auto operator()(Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_CTOR(intersect_all_fn) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            return meta::bind_back(intersect_all_fn{}, std::move(comp), std::move(proj));
+        }
+
+    private:
+        template <typename Comp, typename Proj, typename... Rngs>
+        requires detail::concepts::intersectable_all_range<Comp, Proj, Rngs...>
+        GENEX_INLINE static constexpr auto make_view(Comp comp, Proj proj, Rngs &&... ranges) {
+            return detail::impl::intersect_all_view<Comp, Proj, Rngs...>(
+                std::make_tuple(iterators::begin(std::forward<Rngs>(ranges))...),
+                std::make_tuple(iterators::end(std::forward<Rngs>(ranges))...),
+                std::move(comp), std::move(proj));
+        }
+    };
+
+    export inline constexpr intersect_all_fn intersect_all{};
+}
@@ -4,30 +4,59 @@ module;
 export module genex.views2.materialize;
 export import genex.pipe;
 import genex.concepts;
+import genex.memory;
 import genex.meta;
 import genex.actions.push_back;
 import genex.iterators.iter_pair;
 import std;
 
 namespace genex::views::detail::concepts {
-    template <template <typename> typename Cache, typename I, typename S>
+    template <template <typename...> typename Cache, typename I, typename S>
     concept materializable_iters =
         std::input_iterator<I> and
         std::sentinel_for<S, I> and
         actions::detail::concepts::back_insertable_range<Cache<iter_value_t<I>>, iter_value_t<I>> and
         std::is_constructible_v<Cache<iter_value_t<I>>>;
 
-    template <template <typename> typename Cache, typename Rng>
+    template <template <typename...> typename Cache, typename Rng>
     concept materializable_range =
         input_range<Rng> and
         materializable_iters<Cache, iterator_t<Rng>, sentinel_t<Rng>>;
+
+    template <template <typename...> typename Cache, typename I, typename S, typename Alloc>
+    concept materializable_alloc_iters =
+        std::input_iterator<I> and
+        std::sentinel_for<S, I> and
+        allocator_or_resource<Alloc> and
+        actions::detail::concepts::back_insertable_range<Cache<iter_value_t<I>, rebind_alloc_t<iter_value_t<I>, Alloc>>, iter_value_t<I>> and
+        std::is_constructible_v<Cache<iter_value_t<I>, rebind_alloc_t<iter_value_t<I>, Alloc>>, rebind_alloc_t<iter_value_t<I>, Alloc>>;
+
+    template <template <typename...> typename Cache, typename Rng, typename Alloc>
+    concept materializable_alloc_range =
+        input_range<Rng> and
+        materializable_alloc_iters<Cache, iterator_t<Rng>, sentinel_t<Rng>, Alloc>;
+
+    template <typename Cache, typename I, typename S>
+    concept materializable_into_iters =
+        std::input_iterator<I> and
+        std::sentinel_for<S, I> and
+        actions::detail::concepts::back_insertable_range<Cache, iter_value_t<I>>;
+
+    template <typename Cache, typename Rng>
+    concept materializable_into_range =
+        input_range<Rng> and
+        materializable_into_iters<Cache, iterator_t<Rng>, sentinel_t<Rng>>;
+
+    template <typename Cache, typename Alloc>
+    concept cache_constructible_with =
+        allocator_or_resource<Alloc> and
+        std::is_constructible_v<Cache, rebind_alloc_t<typename Cache::value_type, Alloc>>;
 }
 
 namespace genex::views::detail::impl {
-    template <template <typename> typename Cache, typename I, typename S>
-    requires concepts::materializable_iters<Cache, I, S>
-    GENEX_INLINE constexpr auto do_materialize(I first, S last) -> Cache<iter_value_t<I>> {
-        auto out = Cache<iter_value_t<I>>();
+    template <typename Cache, typename I, typename S>
+    requires concepts::materializable_into_iters<Cache, I, S>
+    GENEX_INLINE constexpr auto do_materialize_into(I first, S last, Cache out) -> Cache {
         if constexpr (std::sized_sentinel_for<S, I> and requires { out.reserve(std::size_t{}); }) {
             out.reserve(static_cast<std::size_t>(last - first));
         }
@@ -36,10 +65,23 @@ namespace genex::views::detail::impl {
         }
         return out;
     }
+
+    template <template <typename...> typename Cache, typename I, typename S>
+    requires concepts::materializable_iters<Cache, I, S>
+    GENEX_INLINE constexpr auto do_materialize(I first, S last) -> Cache<iter_value_t<I>> {
+        return do_materialize_into(std::move(first), std::move(last), Cache<iter_value_t<I>>());
+    }
+
+    template <template <typename...> typename Cache, typename I, typename S, typename Alloc>
+    requires concepts::materializable_alloc_iters<Cache, I, S, Alloc>
+    GENEX_INLINE constexpr auto do_materialize(I first, S last, Alloc const &alloc) -> Cache<iter_value_t<I>, rebind_alloc_t<iter_value_t<I>, Alloc>> {
+        using cache_t = Cache<iter_value_t<I>, rebind_alloc_t<iter_value_t<I>, Alloc>>;
+        return do_materialize_into(std::move(first), std::move(last), cache_t(rebind_allocator<iter_value_t<I>>(alloc)));
+    }
 }
 
 namespace genex::views {
-    template <template <typename> typename Cache>
+    template <template <typename...> typename Cache>
     struct materialize_fn {
         template <typename I, typename S>
         requires detail::concepts::materializable_iters<Cache, I, S>
@@ -58,11 +100,82 @@ namespace genex::views {
             return detail::impl::do_materialize<Cache>(std::move(first), std::move(last));
         }
 
+        template <typename I, typename S, typename Alloc>
+        requires detail::concepts::materializable_alloc_iters<Cache, I, S, Alloc>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Alloc const &alloc) const {
+            return detail::impl::do_materialize<Cache>(std::move(first), std::move(last), alloc);
+        }
+
+        template <typename Rng, typename Alloc>
+        requires detail::concepts::materializable_alloc_range<Cache, Rng, Alloc>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Alloc const &alloc) const {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::do_materialize<Cache>(std::move(first), std::move(last), alloc);
+        }
+
         GENEX_INLINE constexpr auto operator()() const noexcept(
             SAFE_CTOR(materialize_fn)) {
             return meta::bind_back(materialize_fn{});
         }
+
+        template <typename Alloc>
+        requires (allocator_or_resource<Alloc> and not range<Alloc>)
+        GENEX_INLINE constexpr auto operator()(Alloc alloc) const noexcept(
+            SAFE_CTOR(materialize_fn) and SAFE_MOVE(Alloc)) {
+            return meta::bind_back(materialize_fn{}, std::move(alloc));
+        }
+    };
+
+    /**
+     * Like @c materialize_fn, but the cache is a complete container type rather than a template, so caches with extra
+     * non-type parameters (e.g. @c containers::small_vector<T, N>) can be used.
+     * @tparam Cache The container type the range is materialized into.
+     */
+    template <typename Cache>
+    struct materialize_into_fn {
+        template <typename I, typename S>
+        requires detail::concepts::materializable_into_iters<Cache, I, S> and std::default_initializable<Cache>
+        GENEX_INLINE constexpr auto operator()(I first, S last) const noexcept(
+            SAFE_MOVE(I) and SAFE_MOVE(S)) {
+            return detail::impl::do_materialize_into(std::move(first), std::move(last), Cache());
+        }
+
+        template <typename Rng>
+        requires detail::concepts::materializable_into_range<Cache, Rng> and std::default_initializable<Cache>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng) const noexcept(
+            SAFE_MOVE(Rng)) {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::do_materialize_into(std::move(first), std::move(last), Cache());
+        }
+
+        template <typename I, typename S, typename Alloc>
+        requires detail::concepts::materializable_into_iters<Cache, I, S> and detail::concepts::cache_constructible_with<Cache, Alloc>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Alloc const &alloc) const {
+            return detail::impl::do_materialize_into(std::move(first), std::move(last), Cache(rebind_allocator<typename Cache::value_type>(alloc)));
+        }
+
+        template <typename Rng, typename Alloc>
+        requires detail::concepts::materializable_into_range<Cache, Rng> and detail::concepts::cache_constructible_with<Cache, Alloc>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Alloc const &alloc) const {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::do_materialize_into(std::move(first), std::move(last), Cache(rebind_allocator<typename Cache::value_type>(alloc)));
+        }
+
+        GENEX_INLINE constexpr auto operator()() const noexcept(
+            SAFE_CTOR(materialize_into_fn)) {
+            return meta::bind_back(materialize_into_fn{});
+        }
+
+        template <typename Alloc>
+        requires (allocator_or_resource<Alloc> and not range<Alloc>)
+        GENEX_INLINE constexpr auto operator()(Alloc alloc) const noexcept(
+            SAFE_CTOR(materialize_into_fn) and SAFE_MOVE(Alloc)) {
+            return meta::bind_back(materialize_into_fn{}, std::move(alloc));
+        }
     };
 
     export inline constexpr materialize_fn<std::vector> materialize{};
+
+    export template <typename Cache>
+    inline constexpr materialize_into_fn<Cache> materialize_into{};
 }
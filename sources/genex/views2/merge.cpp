@@ -0,0 +1,352 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.merge;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.access;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename... Rngs>
+    using merge_reference_t = std::common_reference_t<range_reference_t<Rngs>...>;
+
+    template <typename Comp, typename Proj, typename... Rngs>
+    concept mergeable_range =
+        sizeof...(Rngs) > 0 and
+        (input_range<Rngs> and ...) and
+        requires {
+            typename std::common_type_t<range_value_t<Rngs>...>;
+            typename merge_reference_t<Rngs...>;
+        } and
+        std::strict_weak_order<Comp&,
+            std::invoke_result_t<Proj&, merge_reference_t<Rngs...>>,
+            std::invoke_result_t<Proj&, merge_reference_t<Rngs...>>>;
+
+    template <typename Rng, typename Comp, typename Proj>
+    concept mergeable_all_range =
+        input_range<Rng> and
+        std::is_lvalue_reference_v<range_reference_t<Rng>> and
+        mergeable_range<Comp, Proj, range_reference_t<Rng>>;
+}
+
+namespace genex::views::detail::impl {
+    /**
+     * A tournament ("loser") tree over @c k sources. Each internal node stores the loser of the match played there
+     * and @c nodes[0] the overall winner, so after the winner advances only the log2(k) matches on its leaf-to-root
+     * path are replayed, one comparison each, against stored losers. This halves the comparisons of a binary heap's
+     * sift-down, which has to compare both children at every level.
+     *
+     * @c before(a, b) decides whether source @c a's head comes first; exhausted sources must compare after all others.
+     */
+    template <typename Nodes>
+    struct loser_tree {
+        Nodes nodes{};
+
+        template <typename Before>
+        GENEX_INLINE constexpr auto build(const std::size_t k, Before &&before) -> void {
+            nodes[0] = play(1, k, before);
+        }
+
+        template <typename Before>
+        GENEX_INLINE constexpr auto replay(const std::size_t k, Before &&before) -> void {
+            auto winner = nodes[0];
+            for (auto node = (winner + k) / 2; node > 0; node /= 2) {
+                if (before(nodes[node], winner)) { std::swap(nodes[node], winner); }
+            }
+            nodes[0] = winner;
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto winner() const noexcept -> std::size_t {
+            return nodes[0];
+        }
+
+    private:
+        template <typename Before>
+        constexpr auto play(const std::size_t node, const std::size_t k, Before &before) -> std::size_t {
+            if (node >= k) { return node - k; }
+            const auto lhs = play(2 * node, k, before);
+            const auto rhs = play(2 * node + 1, k, before);
+            if (before(rhs, lhs)) {
+                nodes[node] = lhs;
+                return rhs;
+            }
+            nodes[node] = rhs;
+            return lhs;
+        }
+    };
+
+    // Orders two heads, treating exhausted sources as greater than everything and breaking ties by source index so
+    // the merge is stable.
+    template <typename Comp, typename Proj, typename Head, typename Done>
+    GENEX_INLINE constexpr auto merge_before(Comp &comp, Proj &proj, Head &&head, Done &&done, const std::size_t a, const std::size_t b) -> bool {
+        if (done(a)) { return false; }
+        if (done(b)) { return true; }
+        decltype(auto) lhs = head(a);
+        decltype(auto) rhs = head(b);
+        if (meta::invoke(comp, meta::invoke(proj, rhs), meta::invoke(proj, lhs))) { return false; }
+        if (meta::invoke(comp, meta::invoke(proj, lhs), meta::invoke(proj, rhs))) { return true; }
+        return a < b;
+    }
+
+    struct merge_sentinel {};
+
+    template <typename Comp, typename Proj, typename... Rngs>
+    requires concepts::mergeable_range<Comp, Proj, Rngs...>
+    struct merge_iterator {
+        static constexpr std::size_t k = sizeof...(Rngs);
+
+        std::tuple<iterator_t<Rngs>...> its;
+        std::tuple<sentinel_t<Rngs>...> sts;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+        loser_tree<std::array<std::size_t, k>> tree;
+
+        using value_type = std::common_type_t<range_value_t<Rngs>...>;
+        using reference_type = concepts::merge_reference_t<Rngs...>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<(forward_range<Rngs> and ...), std::forward_iterator_tag, std::input_iterator_tag>;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(merge_iterator)
+
+        GENEX_INLINE constexpr merge_iterator() = default;
+
+        GENEX_INLINE constexpr merge_iterator(std::tuple<iterator_t<Rngs>...> its, std::tuple<sentinel_t<Rngs>...> sts, Comp comp, Proj proj) :
+            its(std::move(its)), sts(std::move(sts)), comp(std::move(comp)), proj(std::move(proj)) {
+            tree.build(k, before());
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            self.template dispatch<void>(self.tree.winner(), [](auto &it, auto &) { ++it; });
+            self.tree.replay(k, self.before());
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            return self.head(self.tree.winner());
+        }
+
+        GENEX_VIEW_ITER_EQ(merge_iterator, merge_iterator) {
+            return self.its == that.its;
+        }
+
+        GENEX_VIEW_ITER_EQ(merge_iterator, merge_sentinel) {
+            return self.done(self.tree.winner());
+        }
+
+    private:
+        // Applies `f(it, st)` to the source selected at runtime, through a table built once per instantiation.
+        template <typename R, typename Self, typename F>
+        GENEX_INLINE constexpr auto dispatch(this Self &&self, const std::size_t i, F &&f) -> R {
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) -> R {
+                using its_t = decltype((self.its));
+                using sts_t = decltype((self.sts));
+                constexpr R (*table[])(its_t, sts_t, F&) = {
+                    [](its_t its, sts_t sts, F &g) -> R { return g(std::get<Is>(its), std::get<Is>(sts)); }...
+                };
+                return table[i](self.its, self.sts, f);
+            }(std::index_sequence_for<Rngs...>{});
+        }
+
+        template <typename Self>
+        GENEX_INLINE constexpr auto head(this Self &&self, const std::size_t i) -> reference_type {
+            return self.template dispatch<reference_type>(i, [](auto &it, auto &) -> reference_type { return *it; });
+        }
+
+        template <typename Self>
+        GENEX_INLINE constexpr auto done(this Self &&self, const std::size_t i) -> bool {
+            return self.template dispatch<bool>(i, [](auto &it, auto &st) { return it == st; });
+        }
+
+        template <typename Self>
+        GENEX_INLINE constexpr auto before(this Self &&self) {
+            return [&self](const std::size_t a, const std::size_t b) {
+                return merge_before(*self.comp, *self.proj,
+                    [&self](const std::size_t i) -> reference_type { return self.head(i); },
+                    [&self](const std::size_t i) { return self.done(i); }, a, b);
+            };
+        }
+    };
+
+    template <typename Comp, typename Proj, typename... Rngs>
+    requires concepts::mergeable_range<Comp, Proj, Rngs...>
+    struct merge_view {
+        std::tuple<iterator_t<Rngs>...> its;
+        std::tuple<sentinel_t<Rngs>...> sts;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+
+        GENEX_INLINE constexpr merge_view(std::tuple<iterator_t<Rngs>...> its, std::tuple<sentinel_t<Rngs>...> sts, Comp comp, Proj proj) :
+            its(std::move(its)), sts(std::move(sts)), comp(std::move(comp)), proj(std::move(proj)) {
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            return merge_iterator<Comp, Proj, Rngs...>(self.its, self.sts, *self.comp, *self.proj);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            return merge_sentinel();
+        }
+    };
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct merge_all_iterator {
+        std::vector<std::pair<I, S>> heads;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+        loser_tree<std::vector<std::size_t>> tree;
+
+        using value_type = iter_value_t<I>;
+        using reference_type = iter_reference_t<I>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<std::forward_iterator<I>, std::forward_iterator_tag, std::input_iterator_tag>;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(merge_all_iterator)
+
+        GENEX_INLINE constexpr merge_all_iterator() = default;
+
+        GENEX_INLINE constexpr merge_all_iterator(std::vector<std::pair<I, S>> heads, Comp comp, Proj proj) :
+            heads(std::move(heads)), comp(std::move(comp)), proj(std::move(proj)) {
+            if (this->heads.empty()) { return; }
+            tree.nodes.resize(this->heads.size());
+            tree.build(this->heads.size(), before());
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            ++self.heads[self.tree.winner()].first;
+            self.tree.replay(self.heads.size(), self.before());
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            return *self.heads[self.tree.winner()].first;
+        }
+
+        GENEX_VIEW_ITER_EQ(merge_all_iterator, merge_all_iterator) {
+            return std::ranges::equal(self.heads, that.heads, {}, &std::pair<I, S>::first, &std::pair<I, S>::first);
+        }
+
+        GENEX_VIEW_ITER_EQ(merge_all_iterator, merge_sentinel) {
+            return self.heads.empty() or self.heads[self.tree.winner()].first == self.heads[self.tree.winner()].second;
+        }
+
+    private:
+        template <typename Self>
+        GENEX_INLINE constexpr auto before(this Self &&self) {
+            return [&self](const std::size_t a, const std::size_t b) {
+                return merge_before(*self.comp, *self.proj,
+                    [&self](const std::size_t i) -> reference_type { return *self.heads[i].first; },
+                    [&self](const std::size_t i) { return self.heads[i].first == self.heads[i].second; }, a, b);
+            };
+        }
+    };
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct merge_all_view {
+        using inner_t = iter_reference_t<I>;
+
+        std::vector<std::pair<iterator_t<inner_t>, sentinel_t<inner_t>>> heads;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+
+        GENEX_INLINE constexpr merge_all_view(I first, S last, Comp comp, Proj proj) :
+            comp(std::move(comp)), proj(std::move(proj)) {
+            for (; first != last; ++first) {
+                auto &inner = *first;
+                heads.emplace_back(iterators::iter_pair(inner));
+            }
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            return merge_all_iterator<iterator_t<inner_t>, sentinel_t<inner_t>, Comp, Proj>(self.heads, *self.comp, *self.proj);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            return merge_sentinel();
+        }
+    };
+}
+
+namespace genex::views {
+    struct merge_fn {
+        /**
+         * Lazily merges any number of sorted ranges into one sorted sequence, via a loser tree over the range heads.
+         * The ranges come first, optionally followed by a comparator and a projection. Equal elements are yielded in
+         * the order of the ranges they came from.
+         */
+        template <typename... Args>
+        requires (leading_ranges<Args...>() >= 2 and sizeof...(Args) - leading_ranges<Args...>() <= 2)
+        GENEX_INLINE constexpr auto operator()(Args &&... args) const {
+            constexpr auto n = leading_ranges<Args...>();
+            auto all = std::forward_as_tuple(std::forward<Args>(args)...);
+            auto comp = [&] {
+                if constexpr (sizeof...(Args) > n) { return std::get<n>(all); }
+                else { return operations::lt{}; }
+            }();
+            auto proj = [&] {
+                if constexpr (sizeof...(Args) > n + 1) { return std::get<n + 1>(all); }
+                else { return meta::identity{}; }
+            }();
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return make_view(std::move(comp), std::move(proj), std::get<Is>(std::move(all))...);
+            }(std::make_index_sequence<n>{});
+        }
+
+        template <typename Rng2, typename... Args>
+        requires input_range<Rng2> and (sizeof...(Args) <= 2) and (not range<Args> and ...)
+        GENEX_INLINE constexpr auto operator()(Rng2 &&rng2, Args &&... args) const noexcept(
+            SAFE_CTOR(merge_fn)) {
+            return meta::bind_back(merge_fn{}, std::forward<Rng2>(rng2), std::forward<Args>(args)...);
+        }
+
+    private:
+        template <typename Comp, typename Proj, typename... Rngs>
+        requires detail::concepts::mergeable_range<Comp, Proj, Rngs...>
+        GENEX_INLINE static constexpr auto make_view(Comp comp, Proj proj, Rngs &&... ranges) {
+            return detail::impl::merge_view<Comp, Proj, Rngs...>(
+                std::make_tuple(iterators::begin(std::forward<Rngs>(ranges))...),
+                std::make_tuple(iterators::end(std::forward<Rngs>(ranges))...),
+                std::move(comp), std::move(proj));
+        }
+    };
+
+    struct merge_all_fn {
+        /**
+         * Lazily merges a range of sorted ranges (e.g. a @c std::vector of sorted runs) whose count is only known at
+         * runtime. The inner ranges are referenced, so the outer range must yield lvalues that outlive the view.
+         */
+        template <typename I, typename S, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires std::input_iterator<I> and std::sentinel_for<S, I> and std::is_lvalue_reference_v<iter_reference_t<I>> and detail::concepts::mergeable_range<Comp, Proj, iter_reference_t<I>>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Comp comp = {}, Proj proj = {}) const {
+            return detail::impl::merge_all_view<I, S, Comp, Proj>(std::move(first), std::move(last), std::move(comp), std::move(proj));
+        }
+
+        template <typename Rng, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires detail::concepts::mergeable_all_range<Rng, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Comp comp = {}, Proj proj = {}) const {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::merge_all_view<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj>(std::move(first), std::move(last), std::move(comp), std::move(proj));
+        }
+
+        template <typename Comp = operations::lt, typename Proj = meta::identity>
+        requires (not range<Comp>)
+        GENEX_INLINE constexpr auto operator()(Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_CTOR(merge_all_fn) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            return meta::bind_back(merge_all_fn{}, std::move(comp), std::move(proj));
+        }
+    };
+
+    export inline constexpr merge_fn merge{};
+    export inline constexpr merge_all_fn merge_all{};
+}
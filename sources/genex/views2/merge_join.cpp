@@ -0,0 +1,195 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.merge_join;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.algorithms.search_primitives;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename I1, typename S1, typename I2, typename S2, typename Key1, typename Key2, typename Comp>
+    concept merge_joinable_iters =
+        std::input_iterator<I1> and
+        std::forward_iterator<I2> and
+        std::sentinel_for<S1, I1> and
+        std::sentinel_for<S2, I2> and
+        std::indirect_strict_weak_order<Comp, std::projected<I1, Key1>, std::projected<I2, Key2>>;
+
+    template <typename Rng1, typename Rng2, typename Key1, typename Key2, typename Comp>
+    concept merge_joinable_range =
+        input_range<Rng1> and
+        forward_range<Rng2> and
+        merge_joinable_iters<iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<Rng2>, sentinel_t<Rng2>, Key1, Key2, Comp>;
+
+    // A left outer join points at the matching right element (or nullptr), so the right side must yield lvalues.
+    template <bool LeftOuter, typename I2>
+    concept merge_join_right_addressable =
+        not LeftOuter or std::is_lvalue_reference_v<iter_reference_t<I2>>;
+}
+
+namespace genex::views::detail::impl {
+    struct merge_join_sentinel {};
+
+    /**
+     * Walks two inputs sorted by key in lockstep, as @c set_iterator does, but pairs every element of a run of equal
+     * keys on the left with every element of the matching run on the right. The right run is remembered as an
+     * iterator pair and re-walked for each left element with that key, so no element is buffered and the extra
+     * memory is constant; the left side is read once and may be a single-pass input. Runs of smaller right keys are
+     * skipped by galloping.
+     */
+    template <bool LeftOuter, typename I1, typename S1, typename I2, typename S2, typename Key1, typename Key2, typename Comp>
+    requires concepts::merge_joinable_iters<I1, S1, I2, S2, Key1, Key2, Comp>
+    struct merge_join_iterator {
+        I1 it1;
+        S1 st1;
+        I2 run_first;
+        I2 run_last;
+        I2 cur;
+        S2 st2;
+        GENEX_NO_UNIQUE_ADDRESS Key1 key1;
+        GENEX_NO_UNIQUE_ADDRESS Key2 key2;
+        GENEX_NO_UNIQUE_ADDRESS Comp comp;
+        bool matched = false;
+
+        using right_type = std::conditional_t<LeftOuter, std::add_pointer_t<iter_reference_t<I2>>, iter_reference_t<I2>>;
+        using value_type = std::pair<iter_value_t<I1>, std::conditional_t<LeftOuter, right_type, iter_value_t<I2>>>;
+        using reference_type = std::pair<iter_reference_t<I1>, right_type>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<std::forward_iterator<I1>, std::forward_iterator_tag, std::input_iterator_tag>;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(merge_join_iterator)
+
+        GENEX_INLINE constexpr merge_join_iterator() = default;
+
+        GENEX_INLINE constexpr merge_join_iterator(I1 first1, S1 last1, I2 first2, S2 last2, Key1 key1, Key2 key2, Comp comp) :
+            it1(std::move(first1)), st1(std::move(last1)),
+            run_first(first2), run_last(first2), cur(std::move(first2)), st2(std::move(last2)),
+            key1(std::move(key1)), key2(std::move(key2)), comp(std::move(comp)) {
+            fwd_to_valid();
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            if (self.matched and ++self.cur != self.run_last) { return self; }
+            ++self.it1;
+            self.fwd_to_valid();
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            if constexpr (LeftOuter) {
+                return reference_type(*self.it1, self.matched ? std::addressof(*self.cur) : nullptr);
+            }
+            else {
+                return reference_type(*self.it1, *self.cur);
+            }
+        }
+
+        GENEX_VIEW_ITER_EQ(merge_join_iterator, merge_join_iterator) {
+            return self.it1 == that.it1 and self.matched == that.matched and (not self.matched or self.cur == that.cur);
+        }
+
+        GENEX_VIEW_ITER_EQ(merge_join_iterator, merge_join_sentinel) {
+            return self.it1 == self.st1;
+        }
+
+    private:
+        GENEX_INLINE constexpr auto fwd_to_valid() -> void {
+            for (; it1 != st1; ++it1) {
+                decltype(auto) k = meta::invoke(key1, *it1);
+                auto below = [&](auto const &b) { return meta::invoke(comp, meta::invoke(key2, b), k); };
+                auto not_above = [&](auto const &b) { return not meta::invoke(comp, k, meta::invoke(key2, b)); };
+
+                // Consecutive equal keys on the left re-use the right run found for the first of them.
+                if (run_first != run_last and not below(*run_first) and not_above(*run_first)) {
+                    cur = run_first;
+                    matched = true;
+                    return;
+                }
+
+                auto it2 = run_last;
+                if (it2 != st2 and below(*it2)) { it2 = algorithms::detail::impl::gallop(std::move(it2), st2, below); }
+                if (it2 != st2 and not_above(*it2)) {
+                    run_first = it2;
+                    run_last = algorithms::detail::impl::gallop(it2, st2, not_above);
+                    cur = run_first;
+                    matched = true;
+                    return;
+                }
+
+                run_first = run_last = it2;
+                matched = false;
+                if constexpr (LeftOuter) { return; }
+            }
+            matched = false;
+        }
+    };
+
+    template <bool LeftOuter, typename I1, typename S1, typename I2, typename S2, typename Key1, typename Key2, typename Comp>
+    requires concepts::merge_joinable_iters<I1, S1, I2, S2, Key1, Key2, Comp>
+    struct merge_join_view {
+        I1 first1;
+        S1 last1;
+        I2 first2;
+        S2 last2;
+        GENEX_NO_UNIQUE_ADDRESS Key1 key1;
+        GENEX_NO_UNIQUE_ADDRESS Key2 key2;
+        GENEX_NO_UNIQUE_ADDRESS Comp comp;
+
+        GENEX_INLINE constexpr merge_join_view(I1 f1, S1 l1, I2 f2, S2 l2, Key1 k1, Key2 k2, Comp c) :
+            first1(std::move(f1)), last1(std::move(l1)), first2(std::move(f2)), last2(std::move(l2)),
+            key1(std::move(k1)), key2(std::move(k2)), comp(std::move(c)) {
+        }
+
+        template <typename Self>
+        GENEX_ITER_BEGIN {
+            return merge_join_iterator<LeftOuter, I1, S1, I2, S2, Key1, Key2, Comp>(self.first1, self.last1, self.first2, self.last2, self.key1, self.key2, self.comp);
+        }
+
+        template <typename Self>
+        GENEX_ITER_END {
+            return merge_join_sentinel();
+        }
+    };
+}
+
+namespace genex::views {
+    template <bool LeftOuter>
+    struct merge_join_base_fn {
+        template <typename I1, typename S1, typename I2, typename S2, typename Key1 = meta::identity, typename Key2 = meta::identity, typename Comp = operations::lt>
+        requires detail::concepts::merge_joinable_iters<I1, S1, I2, S2, Key1, Key2, Comp> and detail::concepts::merge_join_right_addressable<LeftOuter, I2>
+        GENEX_INLINE constexpr auto operator()(I1 first1, S1 last1, I2 first2, S2 last2, Key1 key1 = {}, Key2 key2 = {}, Comp comp = {}) const noexcept(
+            SAFE_MOVE(I1) and SAFE_MOVE(S1) and SAFE_MOVE(I2) and SAFE_MOVE(S2) and SAFE_MOVE(Key1) and SAFE_MOVE(Key2) and SAFE_MOVE(Comp)) {
+            return detail::impl::merge_join_view<LeftOuter, I1, S1, I2, S2, Key1, Key2, Comp>(
+                std::move(first1), std::move(last1), std::move(first2), std::move(last2), std::move(key1), std::move(key2), std::move(comp));
+        }
+
+        template <typename Rng1, typename Rng2, typename Key1 = meta::identity, typename Key2 = meta::identity, typename Comp = operations::lt>
+        requires detail::concepts::merge_joinable_range<Rng1, Rng2, Key1, Key2, Comp> and detail::concepts::merge_join_right_addressable<LeftOuter, iterator_t<Rng2>>
+        GENEX_INLINE constexpr auto operator()(Rng1 &&rng1, Rng2 &&rng2, Key1 key1 = {}, Key2 key2 = {}, Comp comp = {}) const noexcept(
+            SAFE_MOVE(Key1) and SAFE_MOVE(Key2) and SAFE_MOVE(Comp)) {
+            auto [first1, last1] = iterators::iter_pair(rng1);
+            auto [first2, last2] = iterators::iter_pair(rng2);
+            return detail::impl::merge_join_view<LeftOuter, iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<Rng2>, sentinel_t<Rng2>, Key1, Key2, Comp>(
+                std::move(first1), std::move(last1), std::move(first2), std::move(last2), std::move(key1), std::move(key2), std::move(comp));
+        }
+
+        template <typename Rng2, typename Key1 = meta::identity, typename Key2 = meta::identity, typename Comp = operations::lt>
+        requires (forward_range<Rng2> and not range<Key1>)
+        GENEX_INLINE constexpr auto operator()(Rng2 &&rng2, Key1 key1 = {}, Key2 key2 = {}, Comp comp = {}) const noexcept(
+            SAFE_CTOR(merge_join_base_fn) and SAFE_MOVE(Rng2) and SAFE_MOVE(Key1) and SAFE_MOVE(Key2) and SAFE_MOVE(Comp)) {
+            return meta::bind_back(merge_join_base_fn{}, std::forward<Rng2>(rng2), std::move(key1), std::move(key2), std::move(comp));
+        }
+    };
+
+    using merge_join_fn = merge_join_base_fn<false>;
+    using merge_left_join_fn = merge_join_base_fn<true>;
+
+    export inline constexpr merge_join_fn merge_join{};
+    export inline constexpr merge_left_join_fn merge_left_join{};
+}
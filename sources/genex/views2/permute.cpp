@@ -0,0 +1,62 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.permute;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.views2.transform;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename I1, typename S1, typename I2, typename S2>
+    concept permutable_iters =
+        std::random_access_iterator<I1> and
+        std::sentinel_for<S1, I1> and
+        std::input_iterator<I2> and
+        std::sentinel_for<S2, I2> and
+        std::integral<iter_value_t<I2>>;
+
+    template <typename Rng1, typename Rng2>
+    concept permutable_range =
+        random_access_range<Rng1> and
+        input_range<Rng2> and
+        permutable_iters<iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<Rng2>, sentinel_t<Rng2>>;
+}
+
+namespace genex::views {
+    struct permute_fn {
+        /**
+         * Gathers @c rng through a range of indices, yielding @c rng[i] for each @c i in @c indices (typically the
+         * result of @c genex::sorted_indices). Elements are referenced, not copied, and the view is random access
+         * whenever the index range is.
+         */
+        template <typename I1, typename S1, typename I2, typename S2>
+        requires detail::concepts::permutable_iters<I1, S1, I2, S2>
+        GENEX_INLINE constexpr auto operator()(I1 first1, S1, I2 first2, S2 last2) const noexcept(
+            SAFE_MOVE(I1) and SAFE_MOVE(I2) and SAFE_MOVE(S2)) {
+            return transform(std::move(first2), std::move(last2), [base = std::move(first1)](const auto i) -> decltype(auto) {
+                return base[static_cast<iter_difference_t<I1>>(i)];
+            });
+        }
+
+        template <typename Rng1, typename Rng2>
+        requires detail::concepts::permutable_range<Rng1, Rng2>
+        GENEX_INLINE constexpr auto operator()(Rng1 &&rng1, Rng2 &&rng2) const noexcept(
+            SAFE_MOVE(iterator_t<Rng1>) and SAFE_MOVE(iterator_t<Rng2>) and SAFE_MOVE(sentinel_t<Rng2>)) {
+            auto [first1, last1] = iterators::iter_pair(rng1);
+            auto [first2, last2] = iterators::iter_pair(rng2);
+            return (*this)(std::move(first1), std::move(last1), std::move(first2), std::move(last2));
+        }
+
+        template <typename Rng2>
+        requires input_range<Rng2>
+        GENEX_INLINE constexpr auto operator()(Rng2 &&rng2) const noexcept(
+            SAFE_CTOR(permute_fn)) {
+            return meta::bind_back(permute_fn{}, std::forward<Rng2>(rng2));
+        }
+    };
+
+    export inline constexpr permute_fn permute{};
+}
@@ -5,6 +5,7 @@ export module genex.views2.set_algorithms;
 export import genex.pipe;
 import genex.concepts;
 import genex.meta;
+import genex.algorithms.search_primitives;
 import genex.iterators.iter_pair;
 import genex.operations.cmp;
 import std;
@@ -28,8 +29,15 @@ namespace genex::views::detail::concepts {
 namespace genex::views::detail::impl {
     enum class set_op { difference, intersection, symmetric_difference, union_ };
 
+    // Which input(s) the current output element is taken from; `both` consumes one element of each.
+    enum class set_source : std::uint8_t { none, first, second, both };
+
     struct set_algorithm_sentinel {};
 
+    /**
+     * The iterators rest on the element being yielded, so dereferencing reads straight from the inputs: when both
+     * share a reference type the view yields those references, with no copy per element.
+     */
     template <set_op Op, typename I1, typename S1, typename I2, typename S2, typename Comp, typename Proj1, typename Proj2>
     requires concepts::set_algorithmicable_iters<I1, S1, I2, S2, Comp, Proj1, Proj2>
     struct set_iterator {
@@ -40,14 +48,13 @@ namespace genex::views::detail::impl {
         GENEX_NO_UNIQUE_ADDRESS Comp comp;
         GENEX_NO_UNIQUE_ADDRESS Proj1 proj1;
         GENEX_NO_UNIQUE_ADDRESS Proj2 proj2;
+        set_source src = set_source::none;
 
         using value_type = std::common_type_t<iter_value_t<I1>, iter_value_t<I2>>;
         using reference_type = std::common_reference_t<iter_reference_t<I1>, iter_reference_t<I2>>;
         using difference_type = std::common_type_t<iter_difference_t<I1>, iter_difference_t<I2>>;
-        using iterator_category = std::input_iterator_tag;
+        using iterator_category = std::conditional_t<std::forward_iterator<I1> and std::forward_iterator<I2>, std::forward_iterator_tag, std::input_iterator_tag>;
         using iterator_concept = iterator_category;
-
-        std::optional<value_type> cur_elem = std::nullopt;
         GENEX_ITER_OPS_MINIMAL(set_iterator)
 
         GENEX_INLINE constexpr set_iterator() = default;
@@ -61,6 +68,8 @@ namespace genex::views::detail::impl {
 
         template <typename Self>
         GENEX_VIEW_CUSTOM_NEXT {
+            if (self.src != set_source::second) { ++self.it1; }
+            if (self.src == set_source::second or self.src == set_source::both) { ++self.it2; }
             self.fwd_to_valid();
             return self;
         }
@@ -70,126 +79,88 @@ namespace genex::views::detail::impl {
 
         template <typename Self>
         GENEX_VIEW_CUSTOM_DEREF {
-            return *self.cur_elem;
+            if (self.src == set_source::second) { return static_cast<reference_type>(*self.it2); }
+            return static_cast<reference_type>(*self.it1);
         }
 
         GENEX_VIEW_ITER_EQ(set_iterator, set_iterator) {
-            return self.it1 == that.it1 and self.it2 == that.it2 and self.cur_elem == that.cur_elem;
+            return self.it1 == that.it1 and self.it2 == that.it2 and self.src == that.src;
         }
 
         GENEX_VIEW_ITER_EQ(set_iterator, set_algorithm_sentinel) {
-            return not self.cur_elem.has_value();
+            return self.src == set_source::none;
         }
 
     private:
         template <typename Self>
         GENEX_INLINE constexpr auto fwd_to_valid(this Self &&self) -> void {
-            self.cur_elem.reset();
-
             auto less12 = [&](auto const &a, auto const &b) {
                 return meta::invoke(self.comp, meta::invoke(self.proj1, a), meta::invoke(self.proj2, b));
             };
             auto less21 = [&](auto const &a, auto const &b) {
                 return meta::invoke(self.comp, meta::invoke(self.proj2, b), meta::invoke(self.proj1, a));
             };
+            auto skip1 = [&] {
+                self.it1 = algorithms::detail::impl::gallop(std::move(self.it1), self.st1, [&](auto const &a) { return less12(a, *self.it2); });
+            };
+            auto skip2 = [&] {
+                self.it2 = algorithms::detail::impl::gallop(std::move(self.it2), self.st2, [&](auto const &b) { return less21(*self.it1, b); });
+            };
 
             if constexpr (Op == set_op::difference) {
                 while (self.it1 != self.st1) {
                     if (self.it2 == self.st2 or less12(*self.it1, *self.it2)) {
-                        self.cur_elem = *self.it1;
-                        ++self.it1;
-                        return;
-                    }
-                    if (less12(*self.it1, *self.it2)) {
-                        self.cur_elem = *self.it1;
-                        ++self.it1;
+                        self.src = set_source::first;
                         return;
                     }
                     if (less21(*self.it1, *self.it2)) {
-                        ++self.it2;
+                        skip2();
                         continue;
                     }
                     ++self.it1;
                     ++self.it2;
                 }
-                return;
             }
 
             if constexpr (Op == set_op::intersection) {
                 while (self.it1 != self.st1 and self.it2 != self.st2) {
                     if (less12(*self.it1, *self.it2)) {
-                        ++self.it1;
+                        skip1();
                         continue;
                     }
                     if (less21(*self.it1, *self.it2)) {
-                        ++self.it2;
+                        skip2();
                         continue;
                     }
-                    self.cur_elem = *self.it1;
-                    ++self.it1;
-                    ++self.it2;
+                    self.src = set_source::both;
                     return;
                 }
-                return;
             }
 
-            if constexpr (Op == set_op::symmetric_difference) {
+            if constexpr (Op == set_op::symmetric_difference or Op == set_op::union_) {
                 while (self.it1 != self.st1 or self.it2 != self.st2) {
                     if (self.it1 == self.st1) {
-                        self.cur_elem = *self.it2;
-                        ++self.it2;
-                        return;
-                    }
-                    if (self.it2 == self.st2) {
-                        self.cur_elem = *self.it1;
-                        ++self.it1;
+                        self.src = set_source::second;
                         return;
                     }
-                    if (less12(*self.it1, *self.it2)) {
-                        self.cur_elem = *self.it1;
-                        ++self.it1;
+                    if (self.it2 == self.st2 or less12(*self.it1, *self.it2)) {
+                        self.src = set_source::first;
                         return;
                     }
                     if (less21(*self.it1, *self.it2)) {
-                        self.cur_elem = *self.it2;
-                        ++self.it2;
+                        self.src = set_source::second;
                         return;
                     }
-                    ++self.it1;
-                    ++self.it2;
-                }
-                return;
-            }
-
-            if constexpr (Op == set_op::union_) {
-                while (self.it1 != self.st1 or self.it2 != self.st2) {
-                    if (self.it1 == self.st1) {
-                        self.cur_elem = *self.it2;
-                        ++self.it2;
-                        return;
-                    }
-                    if (self.it2 == self.st2) {
-                        self.cur_elem = *self.it1;
-                        ++self.it1;
+                    if constexpr (Op == set_op::union_) {
+                        self.src = set_source::both;
                         return;
                     }
-                    if (less12(*self.it1, *self.it2)) {
-                        self.cur_elem = *self.it1;
-                        ++self.it1;
-                        return;
-                    }
-                    if (less21(*self.it1, *self.it2)) {
-                        self.cur_elem = *self.it2;
-                        ++self.it2;
-                        return;
-                    }
-                    self.cur_elem = *self.it1;
                     ++self.it1;
                     ++self.it2;
-                    return;
                 }
-                return;
             }
+
+            self.src = set_source::none;
         }
     };
 
@@ -225,7 +196,7 @@ namespace genex::views::detail::impl {
 namespace genex::views {
     template <detail::impl::set_op Op>
     struct set_algorithms_base_fn {
-        template <typename I1, typename S1, typename I2, typename S2, typename Comp = operations::eq, typename Proj1 = meta::identity, typename Proj2 = meta::identity>
+        template <typename I1, typename S1, typename I2, typename S2, typename Comp = operations::lt, typename Proj1 = meta::identity, typename Proj2 = meta::identity>
         requires detail::concepts::set_algorithmicable_iters<I1, S1, I2, S2, Comp, Proj1, Proj2>
         GENEX_INLINE constexpr auto operator()(I1 first1, S1 last1, I2 first2, S2 last2, Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const noexcept(
             // SAFE_IMPL_CTOR(set_algorithm_view, Op, I1, S1, I2, S2, Comp, Proj1, Proj2) and
@@ -233,7 +204,7 @@ namespace genex::views {
             return detail::impl::set_algorithm_view<Op, I1, S1, I2, S2, Comp, Proj1, Proj2>(std::move(first1), std::move(last1), std::move(first2), std::move(last2), std::move(comp), std::move(proj1), std::move(proj2));
         }
 
-        template <typename Rng1, typename Rng2, typename Comp = operations::eq, typename Proj1 = meta::identity, typename Proj2 = meta::identity>
+        template <typename Rng1, typename Rng2, typename Comp = operations::lt, typename Proj1 = meta::identity, typename Proj2 = meta::identity>
         requires detail::concepts::set_algorithmicable_range<Rng1, Rng2, Comp, Proj1, Proj2>
         GENEX_INLINE constexpr auto operator()(Rng1 &&rng1, Rng2 &&rng2, Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const noexcept(
             // SAFE_IMPL_CTOR(set_algorithm_view, Op, iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<Rng2>, sentinel_t<Rng2>, Comp, Proj1, Proj2) and
@@ -243,7 +214,7 @@ namespace genex::views {
             return detail::impl::set_algorithm_view<Op, iterator_t<Rng1>, sentinel_t<Rng1>, iterator_t<Rng2>, sentinel_t<Rng2>, Comp, Proj1, Proj2>(std::move(first1), std::move(last1), std::move(first2), std::move(last2), std::move(comp), std::move(proj1), std::move(proj2));
         }
 
-        template <typename Rng2, typename Comp = operations::eq, typename Proj1 = meta::identity, typename Proj2 = meta::identity>
+        template <typename Rng2, typename Comp = operations::lt, typename Proj1 = meta::identity, typename Proj2 = meta::identity>
         requires (range<Rng2> and not range<Comp>)
         GENEX_INLINE constexpr auto operator()(Rng2 &&rng2, Comp comp = {}, Proj1 proj1 = {}, Proj2 proj2 = {}) const noexcept(
             SAFE_CTOR(set_algorithms_base_fn) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj1) and SAFE_MOVE(Proj2)) {
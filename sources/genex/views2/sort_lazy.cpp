@@ -0,0 +1,195 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.sort_lazy;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename I, typename S, typename Comp, typename Proj>
+    concept lazily_sortable_iters =
+        std::input_iterator<I> and
+        std::sentinel_for<S, I> and
+        std::copyable<iter_value_t<I>> and
+        std::indirect_strict_weak_order<Comp, std::projected<I, Proj>>;
+
+    template <typename Rng, typename Comp, typename Proj>
+    concept lazily_sortable_range =
+        input_range<Rng> and
+        lazily_sortable_iters<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj>;
+}
+
+namespace genex::views::detail::impl {
+    struct sort_lazy_sentinel {};
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct sort_lazy_view;
+
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct sort_lazy_iterator {
+        using view_type = sort_lazy_view<I, S, Comp, Proj>;
+
+        view_type *view = nullptr;
+        std::size_t idx = 0;
+
+        using value_type = iter_value_t<I>;
+        using reference_type = value_type&;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(sort_lazy_iterator)
+
+        GENEX_INLINE constexpr sort_lazy_iterator() = default;
+
+        GENEX_INLINE constexpr explicit sort_lazy_iterator(view_type *view) :
+            view(view) {
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            ++self.idx;
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            if (self.idx >= self.view->sorted_until) { self.view->settle(self.idx); }
+            return self.view->buf[self.idx];
+        }
+
+        GENEX_VIEW_ITER_EQ(sort_lazy_iterator, sort_lazy_iterator) {
+            return self.idx == that.idx;
+        }
+
+        GENEX_VIEW_ITER_EQ(sort_lazy_iterator, sort_lazy_sentinel) {
+            return self.idx == self.view->buf.size();
+        }
+    };
+
+    /**
+     * Incremental quicksort (Paredes & Navarro): the source is copied once on @c begin, and each position is only put
+     * in its final place when it is first dereferenced. A stack of partition boundaries records the work already done,
+     * so reading the first @c k elements costs O(n + k log k) and the remaining suffix is never sorted. Partitioning
+     * is three-way, so runs of equal keys are settled in one step rather than degrading to quadratic time.
+     */
+    template <typename I, typename S, typename Comp, typename Proj>
+    struct sort_lazy_view {
+        I it;
+        S st;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+        std::vector<iter_value_t<I>> buf;
+        std::vector<std::size_t> bounds;
+        std::size_t sorted_until = 0;
+        bool filled = false;
+
+        // Segments this small are finished with a plain sort rather than partitioned further.
+        static constexpr std::size_t small_segment = 16;
+
+        GENEX_INLINE constexpr sort_lazy_view(I first, S last, Comp comp, Proj proj) :
+            it(std::move(first)), st(std::move(last)), comp(std::move(comp)), proj(std::move(proj)) {
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto begin() -> sort_lazy_iterator<I, S, Comp, Proj> {
+            if (not filled) { fill(); }
+            return sort_lazy_iterator<I, S, Comp, Proj>(this);
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto end() noexcept -> sort_lazy_sentinel {
+            return {};
+        }
+
+        /**
+         * Settles every position up to and including @c idx into its final place.
+         */
+        constexpr auto settle(const std::size_t idx) -> void {
+            while (sorted_until <= idx) { advance(); }
+        }
+
+    private:
+        constexpr auto fill() -> void {
+            filled = true;
+            for (; it != st; ++it) { buf.emplace_back(*it); }
+            bounds.push_back(buf.size());
+        }
+
+        GENEX_INLINE constexpr auto better(iter_value_t<I> const &lhs, iter_value_t<I> const &rhs) -> bool {
+            return meta::invoke(*comp, meta::invoke(*proj, lhs), meta::invoke(*proj, rhs));
+        }
+
+        constexpr auto advance() -> void {
+            const auto lo = sorted_until;
+            while (true) {
+                const auto hi = bounds.back();
+                if (hi == lo) {
+                    bounds.pop_back();
+                    continue;
+                }
+                if (hi - lo <= small_segment) {
+                    std::sort(buf.begin() + lo, buf.begin() + hi, [this](auto const &lhs, auto const &rhs) { return better(lhs, rhs); });
+                    sorted_until = hi;
+                    return;
+                }
+
+                // Three-way partition of [lo, hi) around a median-of-three pivot: [lo, l) < p, [l, h) == p, [h, hi) > p.
+                const auto pivot = median_of_three(lo, lo + (hi - lo) / 2, hi - 1);
+                auto l = lo;
+                auto i = lo;
+                auto h = hi;
+                while (i < h) {
+                    if (better(buf[i], pivot)) { std::ranges::swap(buf[l++], buf[i++]); }
+                    else if (better(pivot, buf[i])) { std::ranges::swap(buf[i], buf[--h]); }
+                    else { ++i; }
+                }
+
+                if (l == lo) {
+                    sorted_until = h;
+                    return;
+                }
+                if (h != hi) { bounds.push_back(h); }
+                bounds.push_back(l);
+            }
+        }
+
+        constexpr auto median_of_three(const std::size_t a, const std::size_t b, const std::size_t c) -> iter_value_t<I> {
+            if (better(buf[b], buf[a])) {
+                if (better(buf[c], buf[b])) { return buf[b]; }
+                return better(buf[c], buf[a]) ? buf[c] : buf[a];
+            }
+            if (better(buf[c], buf[a])) { return buf[a]; }
+            return better(buf[c], buf[b]) ? buf[c] : buf[b];
+        }
+    };
+}
+
+namespace genex::views {
+    struct sort_lazy_fn {
+        template <typename I, typename S, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires detail::concepts::lazily_sortable_iters<I, S, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(I first, S last, Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_MOVE(I) and SAFE_MOVE(S) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            return detail::impl::sort_lazy_view<I, S, Comp, Proj>(std::move(first), std::move(last), std::move(comp), std::move(proj));
+        }
+
+        template <typename Rng, typename Comp = operations::lt, typename Proj = meta::identity>
+        requires detail::concepts::lazily_sortable_range<Rng, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_MOVE(iterator_t<Rng>) and SAFE_MOVE(sentinel_t<Rng>) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::sort_lazy_view<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj>(std::move(first), std::move(last), std::move(comp), std::move(proj));
+        }
+
+        template <typename Comp = operations::lt, typename Proj = meta::identity>
+        requires (not range<Comp>)
+        GENEX_INLINE constexpr auto operator()(Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_CTOR(sort_lazy_fn) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            return meta::bind_back(sort_lazy_fn{}, std::move(comp), std::move(proj));
+        }
+    };
+
+    export inline constexpr sort_lazy_fn sort_lazy{};
+}
@@ -24,6 +24,99 @@ namespace genex::views::detail::concepts {
         takeable_last_iters<iterator_t<Rng>, sentinel_t<Rng>, Int>;
 }
 
+namespace genex::views::detail::impl {
+    struct take_last_sentinel {};
+
+    template <typename I, typename S>
+    struct take_last_ring_view;
+
+    template <typename I, typename S>
+    struct take_last_ring_iterator {
+        using view_type = take_last_ring_view<I, S>;
+
+        view_type *view = nullptr;
+        std::size_t idx = 0;
+
+        using value_type = iter_value_t<I>;
+        using reference_type = value_type&;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept = iterator_category;
+        GENEX_ITER_OPS_MINIMAL(take_last_ring_iterator)
+
+        GENEX_INLINE constexpr take_last_ring_iterator() = default;
+
+        GENEX_INLINE constexpr explicit take_last_ring_iterator(view_type *view) :
+            view(view) {
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_NEXT {
+            ++self.idx;
+            return self;
+        }
+
+        template <typename Self>
+        GENEX_VIEW_CUSTOM_DEREF {
+            // The oldest retained element sits at the write head once the ring has wrapped.
+            auto pos = self.view->head + self.idx;
+            if (pos >= self.view->ring.size()) { pos -= self.view->ring.size(); }
+            return self.view->ring[pos];
+        }
+
+        GENEX_VIEW_ITER_EQ(take_last_ring_iterator, take_last_ring_iterator) {
+            return self.idx == that.idx;
+        }
+
+        GENEX_VIEW_ITER_EQ(take_last_ring_iterator, take_last_sentinel) {
+            return self.idx == self.view->ring.size();
+        }
+    };
+
+    /**
+     * Single-pass @c take_last for input ranges: the source is consumed once, on the first call to @c begin, through
+     * a ring of @c n slots that always holds the most recent @c n elements. Memory is O(n) regardless of the length
+     * of the source, and no second traversal (or @c distance) is needed.
+     */
+    template <typename I, typename S>
+    struct take_last_ring_view {
+        I it;
+        S st;
+        std::vector<iter_value_t<I>> ring;
+        std::size_t n;
+        std::size_t head = 0;
+        bool filled = false;
+
+        GENEX_INLINE constexpr take_last_ring_view(I first, S last, const std::size_t n) :
+            it(std::move(first)), st(std::move(last)), n(n) {
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto begin() -> take_last_ring_iterator<I, S> {
+            if (not filled) { fill(); }
+            return take_last_ring_iterator<I, S>(this);
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto end() noexcept -> take_last_sentinel {
+            return {};
+        }
+
+    private:
+        constexpr auto fill() -> void {
+            filled = true;
+            if (n == 0) { return; }
+            ring.reserve(n);
+            for (; it != st; ++it) {
+                if (ring.size() < n) {
+                    ring.emplace_back(*it);
+                    continue;
+                }
+                ring[head] = *it;
+                if (++head == n) { head = 0; }
+            }
+        }
+    };
+}
+
 namespace genex::views {
     struct take_last_fn {
         template <typename I, typename S, typename Int>
@@ -34,6 +127,13 @@ namespace genex::views {
             return genex::span<iter_value_t<I>>(std::move(last) - n, std::move(last));
         }
 
+        template <typename I, typename S, typename Int>
+        requires detail::concepts::takeable_last_iters<I, S, Int> and (not std::forward_iterator<I>)
+        GENEX_INLINE constexpr auto operator()(I first, S last, const Int n) const noexcept(
+            SAFE_MOVE(I) and SAFE_MOVE(S) and SAFE_MOVE(Int)) {
+            return detail::impl::take_last_ring_view<I, S>(std::move(first), std::move(last), static_cast<std::size_t>(n));
+        }
+
         template <typename I, typename S, typename Int>
         requires detail::concepts::takeable_last_iters<I, S, Int>
         GENEX_INLINE constexpr auto operator()(I first, S last, const Int n) const noexcept(
@@ -52,6 +152,14 @@ namespace genex::views {
             return genex::span<range_value_t<Rng>>(std::move(last) - n, std::move(last));
         }
 
+        template <typename Rng, typename Int>
+        requires detail::concepts::takeable_last_range<Rng, Int> and (not std::forward_iterator<iterator_t<Rng>>)
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, const Int n) const noexcept(
+            SAFE_MOVE(iterator_t<Rng>) and SAFE_MOVE(sentinel_t<Rng>) and SAFE_MOVE(Int)) {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::take_last_ring_view<iterator_t<Rng>, sentinel_t<Rng>>(std::move(first), std::move(last), static_cast<std::size_t>(n));
+        }
+
         template <typename Rng, typename Int>
         requires detail::concepts::takeable_last_range<Rng, Int>
         GENEX_INLINE constexpr auto operator()(Rng &&rng, const Int n) const noexcept(
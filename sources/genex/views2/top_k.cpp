@@ -0,0 +1,122 @@
+module;
+#include <genex/macros.hpp>
+
+export module genex.views2.top_k;
+export import genex.pipe;
+import genex.concepts;
+import genex.meta;
+import genex.iterators.iter_pair;
+import genex.operations.cmp;
+import std;
+
+namespace genex::views::detail::concepts {
+    template <typename I, typename S, typename Int, typename Comp, typename Proj>
+    concept top_kable_iters =
+        std::input_iterator<I> and
+        std::sentinel_for<S, I> and
+        std::integral<Int> and
+        std::copyable<iter_value_t<I>> and
+        std::indirect_strict_weak_order<Comp, std::projected<I, Proj>>;
+
+    template <typename Rng, typename Int, typename Comp, typename Proj>
+    concept top_kable_range =
+        input_range<Rng> and
+        top_kable_iters<iterator_t<Rng>, sentinel_t<Rng>, Int, Comp, Proj>;
+}
+
+namespace genex::views::detail::impl {
+    /**
+     * Streams the source once through a bounded heap of @c k elements, in O(n log k) time and O(k) memory. The heap
+     * is keyed so that its top is the worst element kept, so each new element costs one comparison unless it beats
+     * that element. The source is consumed on the first call to @c begin or @c end, after which the view iterates the
+     * kept elements in order, best first.
+     */
+    template <typename I, typename S, typename Comp, typename Proj>
+    requires concepts::top_kable_iters<I, S, std::size_t, Comp, Proj>
+    struct top_k_view {
+        I it;
+        S st;
+        std::size_t k;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Comp> comp;
+        GENEX_NO_UNIQUE_ADDRESS meta::box<Proj> proj;
+        std::vector<iter_value_t<I>> heap;
+        bool filled = false;
+
+        GENEX_INLINE constexpr top_k_view(I first, S last, const std::size_t k, Comp comp, Proj proj) :
+            it(std::move(first)), st(std::move(last)), k(k), comp(std::move(comp)), proj(std::move(proj)) {
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto begin() -> auto {
+            if (not filled) { fill(); }
+            return heap.begin();
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto end() -> auto {
+            if (not filled) { fill(); }
+            return heap.end();
+        }
+
+        GENEX_NODISCARD GENEX_INLINE constexpr auto size() -> std::size_t {
+            if (not filled) { fill(); }
+            return heap.size();
+        }
+
+    private:
+        constexpr auto fill() -> void {
+            filled = true;
+            if (k == 0) { return; }
+            auto better = [this]<typename Lhs, typename Rhs>(Lhs &&lhs, Rhs &&rhs) {
+                return meta::invoke(*comp, meta::invoke(*proj, std::forward<Lhs>(lhs)), meta::invoke(*proj, std::forward<Rhs>(rhs)));
+            };
+            for (; it != st; ++it) {
+                if (heap.size() < k) {
+                    heap.emplace_back(*it);
+                    std::ranges::push_heap(heap, better);
+                    continue;
+                }
+                decltype(auto) elem = *it;
+                if (better(elem, heap.front())) {
+                    std::ranges::pop_heap(heap, better);
+                    heap.back() = std::forward<decltype(elem)>(elem);
+                    std::ranges::push_heap(heap, better);
+                }
+            }
+            std::ranges::sort_heap(heap, better);
+        }
+    };
+}
+
+namespace genex::views {
+    struct top_k_fn {
+        template <typename I, typename S, typename Int, typename Comp = operations::gt, typename Proj = meta::identity>
+        requires detail::concepts::top_kable_iters<I, S, Int, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(I first, S last, const Int k, Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_MOVE(I) and SAFE_MOVE(S) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            return detail::impl::top_k_view<I, S, Comp, Proj>(
+                std::move(first), std::move(last), std::cmp_less(k, 0) ? 0 : static_cast<std::size_t>(k), std::move(comp), std::move(proj));
+        }
+
+        template <typename Rng, typename Int, typename Comp = operations::gt, typename Proj = meta::identity>
+        requires detail::concepts::top_kable_range<Rng, Int, Comp, Proj>
+        GENEX_INLINE constexpr auto operator()(Rng &&rng, const Int k, Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_MOVE(iterator_t<Rng>) and SAFE_MOVE(sentinel_t<Rng>) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            auto [first, last] = iterators::iter_pair(rng);
+            return detail::impl::top_k_view<iterator_t<Rng>, sentinel_t<Rng>, Comp, Proj>(
+                std::move(first), std::move(last), std::cmp_less(k, 0) ? 0 : static_cast<std::size_t>(k), std::move(comp), std::move(proj));
+        }
+
+        template <typename Int, typename Comp = operations::gt, typename Proj = meta::identity>
+        requires std::integral<Int>
+        GENEX_INLINE constexpr auto operator()(const Int k, Comp comp = {}, Proj proj = {}) const noexcept(
+            SAFE_CTOR(top_k_fn) and SAFE_MOVE(Comp) and SAFE_MOVE(Proj)) {
+            return meta::bind_back(top_k_fn{}, k, std::move(comp), std::move(proj));
+        }
+    };
+
+    /**
+     * The @c k best elements of a range under @c comp, best first. With the default @c operations::gt this is the
+     * @c k largest elements in descending order; pass @c operations::lt for the @c k smallest. A negative @c k yields
+     * an empty view.
+     */
+    export inline constexpr top_k_fn top_k{};
+}
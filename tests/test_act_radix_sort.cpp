@@ -0,0 +1,47 @@
+#include <coroutine>
+#include <execution>
+#include <gtest/gtest.h>
+
+import genex.actions.radix_sort;
+
+
+TEST(GenexActionsRadixSort, VecInput) {
+    auto vec = std::vector{7, -4, 5, 6, 3, -2, 1, 4, 9, 0, 8};
+    vec |= genex::actions::radix_sort;
+    const auto exp = std::vector{-4, -2, 0, 1, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexActionsRadixSort, VecInputFloat) {
+    auto vec = std::vector{2.5, -0.5, 1e9, -1e9, 0.0, -3.25};
+    vec |= genex::actions::radix_sort;
+    const auto exp = std::vector{-1e9, -3.25, -0.5, 0.0, 2.5, 1e9};
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexActionsRadixSort, VecInputProjectionIsStable) {
+    auto vec = std::vector<std::pair<std::string, std::uint64_t>>{{"a", 30}, {"b", 10}, {"c", 30}, {"d", 20}, {"e", 10}};
+    vec |= genex::actions::radix_sort([](auto const &p) { return p.second; });
+    const auto exp = std::vector<std::pair<std::string, std::uint64_t>>{{"b", 10}, {"e", 10}, {"d", 20}, {"a", 30}, {"c", 30}};
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexActionsRadixSort, VecInputTupleKey) {
+    auto vec = std::vector<std::tuple<int, float>>{{1, 0.5f}, {0, 2.0f}, {1, -1.0f}, {0, -2.0f}};
+    vec |= genex::actions::radix_sort;
+    const auto exp = std::vector<std::tuple<int, float>>{{0, -2.0f}, {0, 2.0f}, {1, -1.0f}, {1, 0.5f}};
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexActionsRadixSort, VecInputParallel) {
+    auto vec = std::vector<std::int64_t>(100'000);
+    for (auto i = 0uz; i < vec.size(); ++i) { vec[i] = static_cast<std::int64_t>((i * 2654435761u) % 1'000'003) - 500'000; }
+    auto exp = vec;
+    std::ranges::sort(exp);
+    vec |= genex::actions::radix_sort(std::execution::par);
+    EXPECT_EQ(vec, exp);
+}
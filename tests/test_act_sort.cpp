@@ -3,6 +3,7 @@
 
 import genex.actions.sort;
 import genex.operations.cmp;
+import std;
 
 
 TEST(GenexActionsSort, VecInput) {
@@ -19,3 +20,30 @@ TEST(GenexActionsSort, VecInputGreater) {
     const auto exp = std::vector{9, 8, 7, 6, 5, 4, 4, 3, 2, 1, 0};
     EXPECT_EQ(vec, exp);
 }
+
+
+TEST(GenexActionsSort, ArrayInputSortingNetwork) {
+    auto arr = std::array{7, 4, 5, 6, 3, 2, 1, 4, 9, 0, 8};
+    arr |= genex::actions::sort;
+    const auto exp = std::array{0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(arr, exp);
+}
+
+
+TEST(GenexActionsSort, ArrayInputSortingNetworkProjection) {
+    auto arr = std::array<std::string, 5>{"ccc", "a", "bbbb", "dd", ""};
+    arr |= genex::actions::sort(genex::operations::gt{}, &std::string::size);
+    const auto exp = std::array<std::string, 5>{"bbbb", "ccc", "dd", "a", ""};
+    EXPECT_EQ(arr, exp);
+}
+
+
+TEST(GenexActionsSort, ArrayInputSortingNetworkConstexpr) {
+    constexpr auto arr = [] {
+        auto out = std::array{5, 3, 8, 1, 9, 2, 7, 4};
+        genex::actions::sort(out);
+        return out;
+    }();
+    static_assert(arr == std::array{1, 2, 3, 4, 5, 7, 8, 9});
+    EXPECT_TRUE(std::ranges::is_sorted(arr));
+}
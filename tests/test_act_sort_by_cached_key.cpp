@@ -0,0 +1,38 @@
+#include <coroutine>
+#include <gtest/gtest.h>
+
+import genex.actions.sort_by_cached_key;
+import genex.algorithms.sorted_by_cached_key;
+import genex.operations.cmp;
+import std;
+
+
+TEST(GenexActionsSortByCachedKey, VecInput) {
+    auto calls = 0uz;
+    auto vec = std::vector<std::string>{"Pear", "apple", "Fig", "banana"};
+    vec |= genex::actions::sort_by_cached_key([&calls](std::string const &s) {
+        ++calls;
+        auto lowered = s;
+        for (auto &c : lowered) { c = static_cast<char>(std::tolower(c)); }
+        return lowered;
+    });
+    const auto exp = std::vector<std::string>{"apple", "banana", "Fig", "Pear"};
+    EXPECT_EQ(vec, exp);
+    EXPECT_EQ(calls, 4);
+}
+
+
+TEST(GenexActionsSortByCachedKey, VecInputStableGreater) {
+    auto vec = std::vector<std::pair<int, char>>{{1, 'a'}, {3, 'b'}, {1, 'c'}, {2, 'd'}, {3, 'e'}};
+    vec |= genex::actions::sort_by_cached_key([](auto const &p) { return p.first; }, genex::operations::gt{});
+    const auto exp = std::vector<std::pair<int, char>>{{3, 'b'}, {3, 'e'}, {2, 'd'}, {1, 'a'}, {1, 'c'}};
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexAlgosSortedByCachedKey, VecInput) {
+    auto vec = std::vector{-3, 1, -2, 4};
+    const auto srt = genex::sorted_by_cached_key(vec, [](const int x) { return x * x; });
+    const auto exp = std::vector{1, -2, -3, 4};
+    EXPECT_EQ(srt, exp);
+}
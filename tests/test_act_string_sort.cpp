@@ -0,0 +1,30 @@
+#include <coroutine>
+#include <gtest/gtest.h>
+
+import genex.actions.string_sort;
+
+
+TEST(GenexActionsStringSort, VecInput) {
+    auto vec = std::vector<std::string>{"/usr/lib", "/usr/bin", "/etc", "/usr", "", "/usr/bin/env", "/etc/hosts"};
+    vec |= genex::actions::string_sort;
+    const auto exp = std::vector<std::string>{"", "/etc", "/etc/hosts", "/usr", "/usr/bin", "/usr/bin/env", "/usr/lib"};
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexActionsStringSort, VecInputLongCommonPrefix) {
+    auto vec = std::vector<std::string>();
+    for (auto i = 40; i > 0; --i) { vec.push_back("https://example.com/a/very/long/shared/prefix/" + std::to_string(i)); }
+    auto exp = vec;
+    std::ranges::sort(exp);
+    vec |= genex::actions::string_sort;
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexActionsStringSort, VecInputProjection) {
+    auto vec = std::vector<std::pair<int, std::string>>{{0, "pear"}, {1, "apple"}, {2, "fig"}, {3, "apples"}};
+    vec |= genex::actions::string_sort([](auto const &p) -> std::string const& { return p.second; });
+    const auto exp = std::vector<std::pair<int, std::string>>{{1, "apple"}, {3, "apples"}, {2, "fig"}, {0, "pear"}};
+    EXPECT_EQ(vec, exp);
+}
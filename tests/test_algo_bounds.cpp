@@ -0,0 +1,113 @@
+#include <coroutine>
+#include <gtest/gtest.h>
+
+import genex.algorithms.bounds;
+import genex.algorithms.interpolation_search;
+import genex.operations.cmp;
+import std;
+
+
+TEST(GenexAlgosBounds, LowerBound) {
+    auto vec = std::vector{1, 3, 3, 3, 5, 8};
+    EXPECT_EQ(genex::lower_bound(vec, 3) - vec.begin(), 1);
+    EXPECT_EQ(genex::lower_bound(vec, 4) - vec.begin(), 4);
+    EXPECT_EQ(genex::lower_bound(vec, 0) - vec.begin(), 0);
+    EXPECT_EQ(genex::lower_bound(vec, 9) - vec.begin(), 6);
+}
+
+
+TEST(GenexAlgosBounds, UpperBound) {
+    auto vec = std::vector{1, 3, 3, 3, 5, 8};
+    EXPECT_EQ(genex::upper_bound(vec, 3) - vec.begin(), 4);
+    EXPECT_EQ(genex::upper_bound(vec, 8) - vec.begin(), 6);
+    EXPECT_EQ(genex::upper_bound(vec, 0) - vec.begin(), 0);
+}
+
+
+TEST(GenexAlgosBounds, EqualRange) {
+    auto vec = std::vector{1, 3, 3, 3, 5, 8};
+    const auto [lo, hi] = genex::equal_range(vec, 3);
+    EXPECT_EQ(lo - vec.begin(), 1);
+    EXPECT_EQ(hi - vec.begin(), 4);
+
+    const auto [lo2, hi2] = genex::equal_range(vec, 4);
+    EXPECT_EQ(lo2, hi2);
+}
+
+
+TEST(GenexAlgosBounds, ComparatorAndProjection) {
+    auto vec = std::vector<std::string>{"dddd", "ccc", "bb", "aa", "e"};
+    const auto it = genex::lower_bound(vec, 2uz, genex::operations::gt{}, &std::string::size);
+    EXPECT_EQ(it - vec.begin(), 2);
+    const auto jt = genex::upper_bound(vec, 2uz, genex::operations::gt{}, &std::string::size);
+    EXPECT_EQ(jt - vec.begin(), 4);
+}
+
+
+TEST(GenexAlgosBounds, ForwardRange) {
+    auto lst = std::list{1, 2, 4, 4, 7};
+    const auto [lo, hi] = genex::equal_range(lst, 4);
+    EXPECT_EQ(std::distance(lst.begin(), lo), 2);
+    EXPECT_EQ(std::distance(lst.begin(), hi), 4);
+}
+
+
+TEST(GenexAlgosBounds, MatchesStdOnLargeInput) {
+    auto vec = std::vector<std::int64_t>(100'000);
+    auto gen = std::mt19937_64(7);
+    for (auto &x : vec) { x = static_cast<std::int64_t>(gen() % 50'000); }
+    std::ranges::sort(vec);
+
+    for (auto q = std::int64_t{-10}; q < 50'010; q += 37) {
+        EXPECT_EQ(genex::lower_bound(vec, q), std::ranges::lower_bound(vec, q));
+        EXPECT_EQ(genex::upper_bound(vec, q), std::ranges::upper_bound(vec, q));
+    }
+}
+
+
+TEST(GenexAlgosInterpolationSearch, UniformKeys) {
+    auto vec = std::vector<std::uint64_t>(1'000'000);
+    for (auto i = 0uz; i < vec.size(); ++i) { vec[i] = 1'700'000'000'000 + 3 * i; }
+
+    EXPECT_EQ(genex::interpolation_search(vec, 1'700'000'000'000ull + 300) - vec.begin(), 100);
+    EXPECT_EQ(genex::interpolation_search(vec, 1'700'000'000'000ull + 301) - vec.begin(), 101);
+    EXPECT_EQ(genex::interpolation_search(vec, 0ull) - vec.begin(), 0);
+    EXPECT_EQ(genex::interpolation_search(vec, ~0ull), vec.end());
+}
+
+
+TEST(GenexAlgosInterpolationSearch, SkewedKeysMatchLowerBound) {
+    auto vec = std::vector<double>();
+    for (auto i = 0; i < 10'000; ++i) { vec.push_back(std::exp(i / 500.0)); }
+
+    for (auto q = 0.5; q < 1e9; q *= 1.7) {
+        EXPECT_EQ(genex::interpolation_search(vec, q), std::ranges::lower_bound(vec, q));
+    }
+}
+
+
+TEST(GenexAlgosInterpolationSearch, MixedSignednessComparesValues) {
+    auto vec = std::vector<unsigned>();
+    for (auto i = 0u; i < 1'000; ++i) { vec.push_back(i * 3); }
+
+    EXPECT_EQ(genex::interpolation_search(vec, -1), vec.begin());
+    EXPECT_EQ(genex::interpolation_search(vec, 30) - vec.begin(), 10);
+
+    auto signed_vec = std::vector<int>();
+    for (auto i = -500; i < 500; ++i) { signed_vec.push_back(i); }
+    EXPECT_EQ(genex::interpolation_search(signed_vec, 0u) - signed_vec.begin(), 500);
+    EXPECT_EQ(genex::interpolation_search(signed_vec, ~0u), signed_vec.end());
+}
+
+
+TEST(GenexAlgosInterpolationSearch, InfiniteKeys) {
+    constexpr auto inf = std::numeric_limits<double>::infinity();
+    auto vec = std::vector<double>{-inf};
+    for (auto i = 0; i < 1'000; ++i) { vec.push_back(i); }
+    vec.push_back(inf);
+    vec.push_back(inf);
+
+    EXPECT_EQ(genex::interpolation_search(vec, 10.0) - vec.begin(), 11);
+    EXPECT_EQ(genex::interpolation_search(vec, inf) - vec.begin(), 1'001);
+    EXPECT_EQ(genex::interpolation_search(vec, -inf), vec.begin());
+}
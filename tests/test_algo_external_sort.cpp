@@ -0,0 +1,84 @@
+#include <coroutine>
+#include <gtest/gtest.h>
+
+import genex.algorithms.external_sort;
+import genex.operations.cmp;
+import genex.to_container;
+import std;
+
+
+TEST(GenexAlgosExternalSort, FitsInBudget) {
+    auto vec = std::vector{5, 3, 9, 1, 7};
+    auto srt = genex::external_sort(vec, 1 << 20, std::filesystem::temp_directory_path());
+    const auto out = srt | genex::to<std::vector>();
+    const auto exp = std::vector{1, 3, 5, 7, 9};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexAlgosExternalSort, SpillsRuns) {
+    auto vec = std::vector<std::uint64_t>(100'000);
+    auto gen = std::mt19937_64(42);
+    for (auto &x : vec) { x = gen(); }
+
+    // The input is about twelve times the budget, so it cannot be sorted in memory.
+    const auto tmp = std::filesystem::temp_directory_path() / "genex-external-sort-spill-test";
+    std::filesystem::create_directories(tmp);
+    {
+        auto srt = genex::external_sort(vec, 64 * 1024, tmp);
+        EXPECT_FALSE(std::filesystem::is_empty(tmp));
+        const auto out = srt | genex::to<std::vector>();
+        std::ranges::sort(vec);
+        EXPECT_EQ(out, vec);
+    }
+    std::filesystem::remove(tmp);
+}
+
+
+TEST(GenexAlgosExternalSort, TinyBudgetMergesInPasses) {
+    // A 1 KiB budget splits 80 KB of input into 79 runs, far more than one merge can buffer at once.
+    auto vec = std::vector<std::uint32_t>(20'000);
+    auto gen = std::mt19937(7);
+    for (auto &x : vec) { x = static_cast<std::uint32_t>(gen()); }
+
+    auto srt = genex::external_sort(vec, 1024, std::filesystem::temp_directory_path());
+    const auto out = srt | genex::to<std::vector>();
+    std::ranges::sort(vec);
+    EXPECT_EQ(out, vec);
+}
+
+
+TEST(GenexAlgosExternalSort, ComparatorAndProjection) {
+    struct record {
+        std::uint32_t id;
+        float score;
+        auto operator==(record const &) const -> bool = default;
+    };
+    auto vec = std::vector<record>();
+    for (auto i = 0u; i < 5000; ++i) { vec.push_back({i, static_cast<float>((i * 7919) % 5000)}); }
+
+    auto srt = genex::external_sort(vec, 4096, std::filesystem::temp_directory_path(), genex::operations::gt{}, &record::score);
+    const auto out = srt | genex::to<std::vector>();
+    ASSERT_EQ(out.size(), vec.size());
+    EXPECT_TRUE(std::ranges::is_sorted(out, std::ranges::greater{}, &record::score));
+}
+
+
+TEST(GenexAlgosExternalSort, RemovesTemporaryFiles) {
+    const auto tmp = std::filesystem::temp_directory_path() / "genex-external-sort-test";
+    std::filesystem::create_directories(tmp);
+    {
+        auto vec = std::vector<int>(10'000, 1);
+        auto srt = genex::external_sort(vec, 1024, tmp);
+        EXPECT_FALSE(std::filesystem::is_empty(tmp));
+    }
+    EXPECT_TRUE(std::filesystem::is_empty(tmp));
+    std::filesystem::remove(tmp);
+}
+
+
+TEST(GenexAlgosExternalSort, EmptyInput) {
+    auto vec = std::vector<int>{};
+    auto srt = genex::external_sort(vec, 1024, std::filesystem::temp_directory_path());
+    EXPECT_TRUE((srt | genex::to<std::vector>()).empty());
+}
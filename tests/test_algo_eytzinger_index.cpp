@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.algorithms.eytzinger_index;
+import genex.operations.cmp;
+import genex.to_container;
+import genex.views2.in;
+import std;
+
+
+TEST(GenexAlgosEytzingerIndex, LowerBoundMatchesSortedPositions) {
+    auto keys = std::vector<int>();
+    for (auto i = 0; i < 1000; ++i) { keys.push_back(i * 3); }
+    const auto index = genex::eytzinger_index<int>(keys);
+
+    EXPECT_EQ(index.size(), keys.size());
+    for (auto q = -5; q < 3005; ++q) {
+        const auto exp = static_cast<std::size_t>(std::ranges::lower_bound(keys, q) - keys.begin());
+        EXPECT_EQ(index.lower_bound(q), exp);
+    }
+}
+
+
+TEST(GenexAlgosEytzingerIndex, DuplicatesReportFirst) {
+    const auto keys = std::vector{1, 2, 2, 2, 5, 5, 9};
+    const auto index = genex::eytzinger_index<int>(keys);
+
+    EXPECT_EQ(index.lower_bound(2), 1uz);
+    EXPECT_EQ(index.find(5), 4uz);
+    EXPECT_EQ(index.find(3), index.size());
+    EXPECT_EQ(index.lower_bound(10), index.size());
+}
+
+
+TEST(GenexAlgosEytzingerIndex, Contains) {
+    const auto keys = std::vector<std::string>{"apple", "banana", "cherry", "date"};
+    const auto index = genex::eytzinger_index<std::string>(keys);
+
+    EXPECT_TRUE(index.contains(std::string("cherry")));
+    EXPECT_FALSE(index.contains(std::string("blueberry")));
+    EXPECT_FALSE(index.contains(std::string("zucchini")));
+}
+
+
+TEST(GenexAlgosEytzingerIndex, DescendingComparator) {
+    const auto keys = std::vector{9, 7, 5, 3, 1};
+    const auto index = genex::eytzinger_index<int, genex::operations::gt>(keys);
+
+    EXPECT_EQ(index.lower_bound(6), 2uz);
+    EXPECT_TRUE(index.contains(3));
+    EXPECT_FALSE(index.contains(4));
+}
+
+
+TEST(GenexAlgosEytzingerIndex, Empty) {
+    const auto index = genex::eytzinger_index<int>(std::vector<int>{});
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.lower_bound(1), 0uz);
+    EXPECT_FALSE(index.contains(1));
+}
+
+
+TEST(GenexAlgosEytzingerIndex, ProbeSideOfIn) {
+    const auto index = genex::eytzinger_index<int>(std::vector{20, 40, 60, 80});
+    const auto vec = std::vector{10, 20, 30, 40, 50};
+
+    const auto kept = vec
+        | genex::views::in(index)
+        | genex::to<std::vector>();
+    EXPECT_EQ(kept, (std::vector{20, 40}));
+
+    const auto dropped = vec
+        | genex::views::not_in(index)
+        | genex::to<std::vector>();
+    EXPECT_EQ(dropped, (std::vector{10, 30, 50}));
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.algorithms.learned_index;
+import std;
+
+
+TEST(GenexAlgosLearnedIndex, MatchesLowerBound) {
+    auto rng = std::mt19937_64(7);
+    auto keys = std::vector<std::uint64_t>(100000);
+    for (auto &k : keys) { k = rng() % 1000000000000; }
+    std::ranges::sort(keys);
+    const auto index = genex::learned_index<std::uint64_t>(keys);
+
+    EXPECT_EQ(index.size(), keys.size());
+    EXPECT_LT(index.segment_count(), 1000uz);
+    for (auto i = 0; i < 10000; ++i) {
+        const auto q = i % 2 == 0 ? keys[rng() % keys.size()] + 1 : rng() % 1000000000000;
+        EXPECT_EQ(index.lower_bound(keys, q), std::ranges::lower_bound(keys, q));
+    }
+}
+
+
+TEST(GenexAlgosLearnedIndex, LinearKeysNeedOneSegment) {
+    auto keys = std::vector<std::int64_t>();
+    for (auto i = 0; i < 50000; ++i) { keys.push_back(1700000000 + i * 60); }
+    const auto index = genex::learned_index<std::int64_t, 8>(keys);
+
+    EXPECT_EQ(index.segment_count(), 1uz);
+    EXPECT_TRUE(index.contains(keys, 1700000000 + 600 * 60));
+    EXPECT_FALSE(index.contains(keys, 1700000000 + 600 * 60 + 1));
+    EXPECT_EQ(index.lower_bound(keys, 0), keys.begin());
+    EXPECT_EQ(index.lower_bound(keys, 2000000000), keys.end());
+}
+
+
+TEST(GenexAlgosLearnedIndex, DuplicateRuns) {
+    auto keys = std::vector<int>();
+    for (auto k = 0; k < 20; ++k) { keys.insert(keys.end(), 500, k * 10); }
+    const auto index = genex::learned_index<int, 4>(keys);
+
+    for (auto q = -5; q < 205; ++q) {
+        EXPECT_EQ(index.lower_bound(keys, q), std::ranges::lower_bound(keys, q));
+        EXPECT_EQ(index.contains(keys, q), std::ranges::binary_search(keys, q));
+    }
+}
+
+
+TEST(GenexAlgosLearnedIndex, Projection) {
+    using event = std::pair<double, char>;
+    const auto events = std::vector<event>{{-3.5, 'a'}, {-1.0, 'b'}, {0.0, 'c'}, {0.5, 'd'}, {2.25, 'e'}};
+    const auto index = genex::learned_index<double, 0>(events, &event::first);
+
+    EXPECT_EQ(index.lower_bound(events, 0.25, &event::first)->second, 'd');
+    EXPECT_TRUE(index.contains(events, 2.25, &event::first));
+    EXPECT_FALSE(index.contains(events, 1.0, &event::first));
+}
+
+
+TEST(GenexAlgosLearnedIndex, Empty) {
+    const auto keys = std::vector<int>{};
+    const auto index = genex::learned_index<int>(keys);
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.lower_bound(keys, 3), keys.end());
+    EXPECT_FALSE(index.contains(keys, 3));
+}
+
+
+TEST(GenexAlgosLearnedIndex, MixedSignednessComparesValues) {
+    auto keys = std::vector<unsigned>();
+    for (auto k = 0u; k < 1'000; ++k) { keys.push_back(k * 7); }
+    keys.push_back(std::numeric_limits<unsigned>::max());
+    const auto index = genex::learned_index<unsigned, 8>(keys);
+
+    EXPECT_EQ(index.lower_bound(keys, -1), keys.begin());
+    EXPECT_FALSE(index.contains(keys, -1));
+    EXPECT_TRUE(index.contains(keys, 70));
+    EXPECT_EQ(index.lower_bound(keys, 71) - keys.begin(), 11);
+}
@@ -0,0 +1,57 @@
+#include <coroutine>
+#include <gtest/gtest.h>
+
+import genex.algorithms.lower_bound_many;
+import genex.operations.cmp;
+import std;
+
+
+TEST(GenexAlgosLowerBoundMany, UnsortedQueries) {
+    auto vec = std::vector{1, 3, 3, 5, 8, 13, 21};
+    auto queries = std::vector{21, 0, 4, 3, 100, 13, 8, 2, 1, 5, 22, 6, 7, 9, 14, 20, 3};
+
+    auto out = std::vector<std::size_t>();
+    genex::lower_bound_many(vec, queries, std::back_inserter(out));
+    const auto exp = std::vector<std::size_t>{6, 0, 3, 1, 7, 5, 4, 1, 0, 3, 7, 4, 4, 5, 6, 6, 1};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexAlgosLowerBoundMany, SortedQueries) {
+    auto vec = std::vector<std::uint64_t>(100'000);
+    for (auto i = 0uz; i < vec.size(); ++i) { vec[i] = 10 * i; }
+    auto queries = std::vector<std::uint64_t>{0, 5, 10, 10, 99'995, 500'000, 999'990, 2'000'000};
+
+    auto out = std::vector<std::size_t>(queries.size());
+    const auto end = genex::lower_bound_many(vec, queries, out.begin());
+    EXPECT_EQ(end, out.end());
+    const auto exp = std::vector<std::size_t>{0, 1, 1, 1, 10'000, 50'000, 99'999, 100'000};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexAlgosLowerBoundMany, MatchesLowerBound) {
+    auto vec = std::vector<int>(10'000);
+    auto gen = std::mt19937_64(3);
+    for (auto &x : vec) { x = static_cast<int>(gen() % 20'000); }
+    std::ranges::sort(vec);
+    auto queries = std::vector<int>(1'000);
+    for (auto &x : queries) { x = static_cast<int>(gen() % 20'100) - 50; }
+
+    auto out = std::vector<std::size_t>();
+    genex::lower_bound_many(vec, queries, std::back_inserter(out));
+    for (auto i = 0uz; i < queries.size(); ++i) {
+        EXPECT_EQ(out[i], static_cast<std::size_t>(std::ranges::lower_bound(vec, queries[i]) - vec.begin()));
+    }
+}
+
+
+TEST(GenexAlgosBinarySearchMany, Membership) {
+    auto vec = std::vector<std::string>{"apple", "kiwi", "pear"};
+    auto queries = std::vector<std::string>{"pear", "fig", "apple", "zucchini"};
+
+    auto out = std::vector<bool>();
+    genex::binary_search_many(vec, queries, std::back_inserter(out));
+    const auto exp = std::vector{true, false, true, false};
+    EXPECT_EQ(out, exp);
+}
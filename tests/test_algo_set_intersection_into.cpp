@@ -0,0 +1,82 @@
+#include <coroutine>
+#include <gtest/gtest.h>
+
+import genex.algorithms.set_intersection_into;
+import genex.span;
+import std;
+
+
+TEST(GenexAlgosSetIntersectionInto, SimilarSizes32) {
+    auto a = std::vector<std::uint32_t>();
+    auto b = std::vector<std::uint32_t>();
+    for (auto i = 0u; i < 1000; ++i) {
+        a.push_back(2 * i);
+        b.push_back(3 * i);
+    }
+
+    auto out = std::vector<std::uint32_t>(1000);
+    const auto n = genex::set_intersection_into(out, a, b);
+    out.resize(n);
+
+    auto exp = std::vector<std::uint32_t>();
+    for (auto i = 0u; i < 2000; i += 6) { exp.push_back(i); }
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexAlgosSetIntersectionInto, SimilarSizes64) {
+    auto a = std::vector<std::uint64_t>{1, 4, 5, 9, 10, 11, 12, 40, 41, 1ull << 40};
+    auto b = std::vector<std::uint64_t>{0, 4, 6, 9, 11, 13, 40, 42, 1ull << 40};
+
+    auto out = std::vector<std::uint64_t>(b.size());
+    const auto n = genex::set_intersection_into(out, a, b);
+    out.resize(n);
+    const auto exp = std::vector<std::uint64_t>{4, 9, 11, 40, 1ull << 40};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexAlgosSetIntersectionInto, MatchesStdSetIntersection) {
+    // Long enough to run every block kernel the CPU picks, with matches both inside and across block boundaries.
+    auto a = std::vector<std::uint64_t>();
+    auto b = std::vector<std::uint64_t>();
+    for (auto i = 0ull; i < 3000; ++i) {
+        if (i % 3 != 1) { a.push_back(i); }
+        if (i % 5 < 2 or i % 7 == 0) { b.push_back(i); }
+    }
+
+    auto out = std::vector<std::uint64_t>(std::min(a.size(), b.size()));
+    out.resize(genex::set_intersection_into(out, a, b));
+    auto exp = std::vector<std::uint64_t>();
+    std::ranges::set_intersection(a, b, std::back_inserter(exp));
+    EXPECT_EQ(out, exp);
+
+    const auto a32 = std::vector<std::uint32_t>(a.begin(), a.end());
+    const auto b32 = std::vector<std::uint32_t>(b.begin(), b.end());
+    auto out32 = std::vector<std::uint32_t>(out.size());
+    out32.resize(genex::set_intersection_into(out32, a32, b32));
+    EXPECT_EQ(out32, std::vector<std::uint32_t>(exp.begin(), exp.end()));
+}
+
+
+TEST(GenexAlgosSetIntersectionInto, Skewed) {
+    auto big = std::vector<std::uint32_t>(1'000'000);
+    for (auto i = 0u; i < big.size(); ++i) { big[i] = 2 * i; }
+    auto small = std::vector<std::uint32_t>{1, 4, 999, 1000, 1'999'998, 3'000'000};
+
+    auto out = std::array<std::uint32_t, 6>{};
+    const auto n = genex::set_intersection_into(out, genex::span<std::uint32_t>(big.data(), big.size()), small);
+    EXPECT_EQ(n, 3);
+    EXPECT_EQ(out[0], 4);
+    EXPECT_EQ(out[1], 1000);
+    EXPECT_EQ(out[2], 1'999'998);
+}
+
+
+TEST(GenexAlgosSetIntersectionInto, Empty) {
+    auto a = std::vector<std::uint32_t>{};
+    auto b = std::vector<std::uint32_t>{1, 2, 3};
+
+    auto out = std::vector<std::uint32_t>{};
+    EXPECT_EQ(genex::set_intersection_into(out, a, b), 0);
+}
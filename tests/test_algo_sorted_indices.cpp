@@ -0,0 +1,54 @@
+#include <coroutine>
+#include <gtest/gtest.h>
+
+import genex.algorithms.sorted_indices;
+import genex.operations.cmp;
+import genex.to_container;
+import genex.views2.permute;
+
+
+TEST(GenexAlgosSortedIndices, VecInput) {
+    auto vec = std::vector{30, 10, 40, 20};
+    const auto idx = genex::sorted_indices(vec);
+    const auto exp = std::vector<std::size_t>{1, 3, 0, 2};
+    EXPECT_EQ(idx, exp);
+    EXPECT_EQ(vec, (std::vector{30, 10, 40, 20}));
+}
+
+
+TEST(GenexAlgosSortedIndices, VecInputNarrowIndexProjection) {
+    auto vec = std::vector<std::string>{"ccc", "a", "bb"};
+    const auto idx = genex::sorted_indices_as<std::uint32_t>(vec, genex::operations::gt{}, &std::string::size);
+    const auto exp = std::vector<std::uint32_t>{0, 2, 1};
+    EXPECT_EQ(idx, exp);
+}
+
+
+TEST(GenexAlgosSortedIndices, IndexTypeTooNarrowThrows) {
+    const auto vec = std::vector<int>(257);
+    EXPECT_THROW(genex::sorted_indices_as<std::uint8_t>(vec), std::length_error);
+    EXPECT_EQ(genex::sorted_indices_as<std::uint8_t>(std::vector<int>(256)).size(), 256u);
+}
+
+
+TEST(GenexViewsPermute, ParallelColumns) {
+    auto keys = std::vector{3, 1, 2};
+    auto names = std::vector<std::string>{"c", "a", "b"};
+    const auto idx = genex::sorted_indices(keys);
+
+    const auto rng = names
+        | genex::views::permute(idx)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::string>{"a", "b", "c"};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsPermute, RandomAccessReferences) {
+    auto vec = std::vector{10, 20, 30};
+    const auto idx = std::vector<std::size_t>{2, 0};
+    auto rng = genex::views::permute(vec, idx);
+    EXPECT_EQ(rng.begin()[1], 10);
+    *rng.begin() = 99;
+    EXPECT_EQ(vec[2], 99);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.containers.flat_map;
+import genex.meta;
+import genex.to_container;
+import std;
+
+
+TEST(GenexContainersFlatMap, BulkConstructKeepsFirstOfEachKey) {
+    const auto map = genex::containers::flat_map<std::string, int>{{"b", 2}, {"a", 1}, {"b", 20}, {"c", 3}};
+    const auto exp = std::vector<std::pair<std::string, int>>{{"a", 1}, {"b", 2}, {"c", 3}};
+    EXPECT_TRUE(std::ranges::equal(map, exp));
+}
+
+
+TEST(GenexContainersFlatMap, IndexAndAt) {
+    auto map = genex::containers::flat_map<std::string, int>{};
+    map["x"] = 1;
+    map["y"] += 5;
+    map["x"] += 1;
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at("x"), 2);
+    EXPECT_EQ(map.at("y"), 5);
+    EXPECT_THROW(static_cast<void>(map.at("z")), std::out_of_range);
+}
+
+
+TEST(GenexContainersFlatMap, TryEmplaceAndInsertOrAssign) {
+    auto map = genex::containers::flat_map<int, std::string>{{1, "one"}};
+    EXPECT_FALSE(map.try_emplace(1, "uno").second);
+    EXPECT_EQ(map.at(1), "one");
+    EXPECT_TRUE(map.try_emplace(2, 3, 'x').second);
+    EXPECT_EQ(map.at(2), "xxx");
+
+    EXPECT_FALSE(map.insert_or_assign(1, "uno").second);
+    EXPECT_EQ(map.at(1), "uno");
+}
+
+
+TEST(GenexContainersFlatMap, FindAndModify) {
+    auto map = genex::containers::flat_map<int, int>{{3, 30}, {1, 10}};
+    map.find(3)->second = 33;
+    EXPECT_EQ(map.at(3), 33);
+    EXPECT_EQ(map.find(2), map.end());
+    EXPECT_TRUE(map.contains(1));
+}
+
+
+TEST(GenexContainersFlatMap, KeysAreReadOnlyThroughIterators) {
+    auto map = genex::containers::flat_map<int, int>{{1, 10}, {2, 20}, {3, 30}};
+    static_assert(not std::is_assignable_v<decltype((map.begin()->first)), int>);
+    static_assert(std::is_assignable_v<decltype((map.begin()->second)), int>);
+    static_assert(std::random_access_iterator<decltype(map.begin())>);
+
+    for (auto [key, value] : map) { value += key; }
+    EXPECT_EQ(map.at(3), 33);
+
+    const auto next = map.erase(map.find(2));
+    EXPECT_EQ(next->first, 3);
+    EXPECT_EQ(map.size(), 2);
+}
+
+
+TEST(GenexContainersFlatMap, InsertRangeExistingWins) {
+    auto map = genex::containers::flat_map<int, char>{{2, 'b'}, {4, 'd'}};
+    map.insert_range(std::vector<std::pair<int, char>>{{3, 'c'}, {2, 'X'}, {1, 'a'}});
+
+    const auto exp = std::vector<std::pair<int, char>>{{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'}};
+    EXPECT_TRUE(std::ranges::equal(std::as_const(map), exp));
+}
+
+
+TEST(GenexContainersFlatMap, SetOperationsByKey) {
+    const auto a = genex::containers::flat_map<int, char>{{1, 'a'}, {2, 'b'}, {3, 'c'}};
+    const auto b = genex::containers::flat_map<int, char>{{2, 'B'}, {3, 'C'}, {4, 'D'}};
+
+    const auto both = a.set_intersection(b) | genex::to<std::vector>();
+    EXPECT_EQ(both, (std::vector<std::pair<int, char>>{{2, 'b'}, {3, 'c'}}));
+
+    const auto rest = a.set_difference(std::vector{1, 3}, genex::meta::identity{}) | genex::to<std::vector>();
+    EXPECT_EQ(rest, (std::vector<std::pair<int, char>>{{2, 'b'}}));
+}
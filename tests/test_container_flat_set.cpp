@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.containers.flat_set;
+import genex.operations.cmp;
+import genex.to_container;
+import std;
+
+
+TEST(GenexContainersFlatSet, BulkConstructSortsAndDeduplicates) {
+    const auto set = genex::containers::flat_set<int>{5, 1, 4, 1, 3, 5, 2};
+    const auto exp = std::vector{1, 2, 3, 4, 5};
+    EXPECT_EQ(set.size(), 5);
+    EXPECT_TRUE(std::ranges::equal(set, exp));
+}
+
+
+TEST(GenexContainersFlatSet, InsertAndErase) {
+    auto set = genex::containers::flat_set<std::string>{"b", "d"};
+    EXPECT_TRUE(set.insert("c").second);
+    EXPECT_FALSE(set.insert("b").second);
+    EXPECT_EQ(*set.insert("a").first, "a");
+    EXPECT_EQ(set.erase("d"), 1);
+    EXPECT_EQ(set.erase("z"), 0);
+
+    const auto exp = std::vector<std::string>{"a", "b", "c"};
+    EXPECT_TRUE(std::ranges::equal(set, exp));
+}
+
+
+TEST(GenexContainersFlatSet, Lookup) {
+    const auto set = genex::containers::flat_set<int>{10, 20, 30};
+    EXPECT_TRUE(set.contains(20));
+    EXPECT_FALSE(set.contains(25));
+    EXPECT_EQ(set.count(30), 1);
+    EXPECT_EQ(*set.lower_bound(25), 30);
+    EXPECT_EQ(*set.upper_bound(20), 30);
+    EXPECT_EQ(set.find(15), set.end());
+}
+
+
+TEST(GenexContainersFlatSet, InsertRangeMerges) {
+    auto set = genex::containers::flat_set<int>{2, 4, 6, 8};
+    set.insert_range(std::vector{9, 1, 4, 5, 5});
+
+    const auto exp = std::vector{1, 2, 4, 5, 6, 8, 9};
+    EXPECT_TRUE(std::ranges::equal(set, exp));
+}
+
+
+TEST(GenexContainersFlatSet, DescendingComparator) {
+    const auto set = genex::containers::flat_set<int, genex::operations::gt>{3, 1, 2, 3};
+    const auto exp = std::vector{3, 2, 1};
+    EXPECT_TRUE(std::ranges::equal(set, exp));
+    EXPECT_EQ(*set.lower_bound(2), 2);
+}
+
+
+TEST(GenexContainersFlatSet, SetOperations) {
+    const auto a = genex::containers::flat_set<int>{1, 2, 3, 4, 5};
+    const auto b = genex::containers::flat_set<int>{4, 5, 6, 7};
+
+    EXPECT_EQ(a.set_union(b) | genex::to<std::vector>(), (std::vector{1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(a.set_intersection(b) | genex::to<std::vector>(), (std::vector{4, 5}));
+    EXPECT_EQ(a.set_difference(b) | genex::to<std::vector>(), (std::vector{1, 2, 3}));
+    EXPECT_EQ(a.set_symmetric_difference(b) | genex::to<std::vector>(), (std::vector{1, 2, 3, 6, 7}));
+
+    const auto c = a.set_intersection(std::vector{0, 2, 4, 8}) | genex::to<genex::containers::flat_set>();
+    EXPECT_EQ(c, (genex::containers::flat_set<int>{2, 4}));
+}
+
+
+TEST(GenexContainersFlatSet, ThrowingInsertRangeLeavesSetUnchanged) {
+    // Comparing against the poisoned key throws, part-way through sorting the new elements.
+    struct throwing_lt {
+        auto operator()(int a, int b) const -> bool {
+            if (a == 13 or b == 13) { throw std::runtime_error("compare"); }
+            return a < b;
+        }
+    };
+
+    auto set = genex::containers::flat_set<int, throwing_lt>{2, 4, 6, 8};
+    EXPECT_THROW(set.insert_range(std::vector{7, 1, 13, 5}), std::runtime_error);
+    const auto exp = std::vector{2, 4, 6, 8};
+    EXPECT_TRUE(std::ranges::equal(set, exp));
+}
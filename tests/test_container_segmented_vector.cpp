@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.containers.segmented_vector;
+import genex.memory;
+import genex.to_container;
+import genex.views2.filter;
+import genex.views2.materialize;
+import std;
+
+
+TEST(GenexContainersSegmentedVector, AppendAcrossBlocks) {
+    using vec_t = genex::containers::segmented_vector<int>;
+    auto vec = vec_t{};
+    const auto n = static_cast<int>(vec_t::first_block * 5);
+    for (auto i = 0; i < n; ++i) { vec.push_back(i); }
+    EXPECT_EQ(vec.size(), static_cast<std::size_t>(n));
+    for (auto i = 0; i < n; ++i) { EXPECT_EQ(vec[i], i); }
+
+    auto expected = 0;
+    for (auto x : vec) { EXPECT_EQ(x, expected++); }
+    EXPECT_EQ(expected, n);
+    EXPECT_EQ(*(vec.begin() + (n - 1)), n - 1);
+    EXPECT_EQ(vec.end() - vec.begin(), n);
+}
+
+
+TEST(GenexContainersSegmentedVector, StableAddresses) {
+    auto vec = genex::containers::segmented_vector<std::string>{"a", "b"};
+    const auto *first = &vec[0];
+    for (auto i = 0; i < 1000; ++i) { vec.emplace_back("x"); }
+    EXPECT_EQ(&vec[0], first);
+    EXPECT_EQ(*first, "a");
+}
+
+
+TEST(GenexContainersSegmentedVector, ToContainer) {
+    auto vec = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    const auto rng = vec
+        | genex::views::filter([](auto x) { return x % 3 == 0; })
+        | genex::to<genex::containers::segmented_vector<int>>();
+    const auto exp = genex::containers::segmented_vector<int>{0, 3, 6, 9};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexContainersSegmentedVector, MaterializeInto) {
+    auto vec = std::vector{0, 1, 2, 3, 4, 5};
+
+    const auto rng = vec
+        | genex::views::filter([](auto x) { return x % 2 == 0; })
+        | genex::views::materialize_into<genex::containers::segmented_vector<int>>;
+    const auto exp = genex::containers::segmented_vector<int>{0, 2, 4};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexContainersSegmentedVector, Flatten) {
+    auto vec = genex::containers::segmented_vector<std::string>{};
+    for (auto i = 0; i < 100; ++i) { vec.push_back(std::to_string(i)); }
+
+    const auto copied = vec.flatten();
+    EXPECT_EQ(copied.size(), 100);
+    EXPECT_EQ(copied[42], "42");
+    EXPECT_EQ(vec[42], "42");
+
+    const auto moved = std::move(vec).flatten();
+    EXPECT_EQ(moved, copied);
+}
+
+
+namespace {
+    // Tracks the bytes currently allocated through it, to check that nothing is leaked.
+    struct counting_resource : std::pmr::memory_resource {
+        std::ptrdiff_t outstanding = 0;
+
+        auto do_allocate(const std::size_t bytes, const std::size_t align) -> void* override {
+            outstanding += static_cast<std::ptrdiff_t>(bytes);
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+
+        auto do_deallocate(void *p, const std::size_t bytes, const std::size_t align) -> void override {
+            outstanding -= static_cast<std::ptrdiff_t>(bytes);
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+
+        auto do_is_equal(std::pmr::memory_resource const &that) const noexcept -> bool override {
+            return this == &that;
+        }
+    };
+
+    struct throws_on_copy {
+        int x;
+        explicit throws_on_copy(const int x) : x(x) {}
+        throws_on_copy(throws_on_copy const &that) : x(that.x) { if (x < 0) { throw std::runtime_error("copy"); } }
+    };
+}
+
+
+TEST(GenexContainersSegmentedVector, MoveAssignBetweenArenas) {
+    using vec_t = genex::containers::segmented_vector<int, std::pmr::polymorphic_allocator<int>>;
+    auto arena1 = genex::arena(1 << 16);
+    auto arena2 = genex::arena(1 << 16);
+
+    auto src = vec_t(&arena1);
+    for (auto i = 0; i < 1000; ++i) { src.push_back(i); }
+    auto dst = vec_t(&arena2);
+    dst = std::move(src);
+
+    // The blocks belong to the other arena, so the elements are moved rather than the blocks taken over.
+    EXPECT_EQ(dst.get_allocator().resource(), &arena2);
+    EXPECT_EQ(dst.size(), 1000);
+    EXPECT_EQ(dst[999], 999);
+    EXPECT_TRUE(src.empty());
+
+    auto same = vec_t(&arena2);
+    same = std::move(dst);
+    EXPECT_EQ(same.size(), 1000);
+    EXPECT_EQ(same[500], 500);
+}
+
+
+TEST(GenexContainersSegmentedVector, ThrowingConstructionFreesBlocks) {
+    auto resource = counting_resource();
+    auto src = std::vector<throws_on_copy>();
+    for (auto i = 0; i < 100; ++i) { src.emplace_back(i); }
+    src.emplace_back(-1);
+
+    using vec_t = genex::containers::segmented_vector<throws_on_copy, std::pmr::polymorphic_allocator<throws_on_copy>>;
+    EXPECT_THROW(vec_t(src.begin(), src.end(), &resource), std::runtime_error);
+    EXPECT_EQ(resource.outstanding, 0);
+}
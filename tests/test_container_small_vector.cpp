@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.containers.small_vector;
+import genex.to_container;
+import genex.views2.filter;
+import genex.views2.materialize;
+import std;
+
+
+TEST(GenexContainersSmallVector, StaysInline) {
+    auto vec = genex::containers::small_vector<int, 4>{};
+    vec.push_back(1);
+    vec.push_back(2);
+    vec.push_back(3);
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec[2], 3);
+}
+
+
+TEST(GenexContainersSmallVector, SpillsToHeap) {
+    auto vec = genex::containers::small_vector<std::string, 2>{"a", "b"};
+    vec.push_back("c");
+    vec.emplace_back(vec[0]);
+    EXPECT_FALSE(vec.is_inline());
+    const auto exp = genex::containers::small_vector<std::string, 2>{"a", "b", "c", "a"};
+    EXPECT_EQ(vec, exp);
+}
+
+
+TEST(GenexContainersSmallVector, MoveInlineAndHeap) {
+    auto small = genex::containers::small_vector<std::string, 4>{"a", "b"};
+    auto moved_small = std::move(small);
+    EXPECT_TRUE(moved_small.is_inline());
+    EXPECT_EQ(moved_small.size(), 2);
+
+    auto large = genex::containers::small_vector<std::string, 1>{"a", "b", "c"};
+    const auto *data = large.data();
+    auto moved_large = std::move(large);
+    EXPECT_EQ(moved_large.data(), data);
+    EXPECT_TRUE(large.empty());
+}
+
+
+TEST(GenexContainersSmallVector, ToContainer) {
+    auto vec = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    const auto rng = vec
+        | genex::views::filter([](auto x) { return x % 3 == 0; })
+        | genex::to<genex::containers::small_vector<int, 8>>();
+    const auto exp = genex::containers::small_vector<int, 8>{0, 3, 6, 9};
+    EXPECT_EQ(rng, exp);
+    EXPECT_TRUE(rng.is_inline());
+}
+
+
+TEST(GenexContainersSmallVector, MaterializeInto) {
+    auto vec = std::vector{0, 1, 2, 3, 4, 5};
+
+    const auto rng = vec
+        | genex::views::filter([](auto x) { return x % 2 == 0; })
+        | genex::views::materialize_into<genex::containers::small_vector<int, 16>>;
+    const auto exp = genex::containers::small_vector<int, 16>{0, 2, 4};
+    EXPECT_EQ(rng, exp);
+    EXPECT_TRUE(rng.is_inline());
+}
+
+
+namespace {
+    // Tracks the bytes currently allocated through it, to check that nothing is leaked.
+    struct counting_resource : std::pmr::memory_resource {
+        std::ptrdiff_t outstanding = 0;
+
+        auto do_allocate(const std::size_t bytes, const std::size_t align) -> void* override {
+            outstanding += static_cast<std::ptrdiff_t>(bytes);
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+
+        auto do_deallocate(void *p, const std::size_t bytes, const std::size_t align) -> void override {
+            outstanding -= static_cast<std::ptrdiff_t>(bytes);
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+
+        auto do_is_equal(std::pmr::memory_resource const &that) const noexcept -> bool override {
+            return this == &that;
+        }
+    };
+
+    struct throws_on_copy {
+        int x;
+        explicit throws_on_copy(const int x) : x(x) {}
+        throws_on_copy(throws_on_copy const &that) : x(that.x) { if (x < 0) { throw std::runtime_error("copy"); } }
+    };
+}
+
+
+TEST(GenexContainersSmallVector, MoveAssignUnequalAllocators) {
+    using vec_t = genex::containers::small_vector<int, 1, std::pmr::polymorphic_allocator<int>>;
+    auto res1 = std::pmr::monotonic_buffer_resource{};
+    auto res2 = std::pmr::monotonic_buffer_resource{};
+
+    auto src = vec_t(std::pmr::polymorphic_allocator<int>(&res1));
+    for (auto i = 0; i < 8; ++i) { src.push_back(i); }
+    auto dst = vec_t(std::pmr::polymorphic_allocator<int>(&res2));
+    dst = std::move(src);
+
+    // The buffer belongs to the other resource, so the elements are moved rather than the buffer stolen.
+    EXPECT_EQ(dst.get_allocator().resource(), &res2);
+    EXPECT_EQ(dst.size(), 8);
+    EXPECT_EQ(dst[7], 7);
+    EXPECT_TRUE(src.empty());
+}
+
+
+TEST(GenexContainersSmallVector, ThrowingGrowthKeepsContents) {
+    auto vec = genex::containers::small_vector<throws_on_copy, 2>{};
+    vec.emplace_back(1);
+    vec.emplace_back(2);
+    EXPECT_THROW(vec.push_back(throws_on_copy(-1)), std::runtime_error);
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec[1].x, 2);
+}
+
+
+TEST(GenexContainersSmallVector, ThrowingConstructionFreesHeap) {
+    auto resource = counting_resource();
+    auto src = std::vector<throws_on_copy>();
+    for (auto i = 0; i < 10; ++i) { src.emplace_back(i); }
+    src.emplace_back(-1);
+
+    using vec_t = genex::containers::small_vector<throws_on_copy, 2, std::pmr::polymorphic_allocator<throws_on_copy>>;
+    EXPECT_THROW(vec_t(src.begin(), src.end(), &resource), std::runtime_error);
+    EXPECT_EQ(resource.outstanding, 0);
+}
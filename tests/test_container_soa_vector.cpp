@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.containers.soa_vector;
+import genex.to_container;
+import genex.views2.tuple_nth;
+import genex.views2.zip;
+
+
+TEST(GenexContainersSoaVector, PushAndColumns) {
+    auto soa = genex::containers::soa_vector<int, std::string>{};
+    soa.push_back(std::tuple{1, std::string("a")});
+    soa.emplace_back(2, "b");
+    EXPECT_EQ(soa.size(), 2);
+
+    const auto ids = soa.column<0>() | genex::to<std::vector>();
+    const auto exp = std::vector{1, 2};
+    EXPECT_EQ(ids, exp);
+}
+
+
+TEST(GenexContainersSoaVector, RowProxyWritesThrough) {
+    auto soa = genex::containers::soa_vector<int, double>{{1, 1.5}, {2, 2.5}};
+    for (auto [id, score] : soa) {
+        score *= 2;
+    }
+    EXPECT_EQ(std::get<1>(soa[0]), 3.0);
+    EXPECT_EQ(std::get<1>(soa[1]), 5.0);
+}
+
+
+TEST(GenexContainersSoaVector, TupleNth) {
+    auto soa = genex::containers::soa_vector<int, int>{{0, 10}, {1, 11}, {2, 12}};
+
+    const auto rng = soa
+        | genex::views::tuple_nth<1>()
+        | genex::to<std::vector>();
+    const auto exp = std::vector{10, 11, 12};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexContainersSoaVector, UnzipTo) {
+    auto vec1 = std::vector{0, 1, 2};
+    auto vec2 = std::vector<std::string>{"a", "b", "c"};
+
+    const auto soa = genex::views::zip(vec1, vec2)
+        | genex::unzip_to<genex::containers::soa_vector>();
+    const auto exp = genex::containers::soa_vector<int, std::string>{{0, "a"}, {1, "b"}, {2, "c"}};
+    EXPECT_EQ(soa, exp);
+}
+
+
+TEST(GenexContainersSoaVector, UnzipPairRows) {
+    const auto rows = std::vector<std::pair<int, std::string>>{{0, "a"}, {1, "b"}, {2, "c"}};
+
+    const auto soa = rows | genex::unzip_to<genex::containers::soa_vector>();
+    const auto exp = genex::containers::soa_vector<int, std::string>{{0, "a"}, {1, "b"}, {2, "c"}};
+    EXPECT_EQ(soa, exp);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.memory;
+import genex.to_container;
+import genex.algorithms.sorted;
+import genex.views2.duplicates;
+import genex.views2.filter;
+import genex.views2.materialize;
+
+
+TEST(GenexMemoryArena, SortedInArena) {
+    auto scratch = genex::arena(1024);
+    auto vec = std::vector{5, 3, 1, 4, 2};
+
+    const auto srt = genex::sorted(vec, {}, {}, &scratch);
+    const auto exp = std::vector{1, 2, 3, 4, 5};
+    EXPECT_TRUE(std::ranges::equal(srt, exp));
+    EXPECT_EQ(srt.get_allocator().resource(), &scratch);
+}
+
+
+TEST(GenexMemoryArena, MaterializeInArena) {
+    auto scratch = genex::arena(1024);
+    auto vec = std::vector{0, 1, 2, 3, 4, 5};
+
+    const auto rng = vec
+        | genex::views::filter([](auto x) { return x % 2 == 0; })
+        | genex::views::materialize(&scratch);
+    const auto exp = std::vector{0, 2, 4};
+    EXPECT_TRUE(std::ranges::equal(rng, exp));
+    EXPECT_EQ(rng.get_allocator().resource(), &scratch);
+}
+
+
+TEST(GenexMemoryArena, DuplicatesInArena) {
+    auto scratch = genex::arena(1024);
+    auto vec = std::vector{1, 2, 3, 4, 1, 2};
+
+    const auto rng = vec
+        | genex::views::duplicates({}, {}, &scratch)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{1, 1};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexMemoryArena, ToWithAllocator) {
+    auto scratch = genex::arena(1024);
+    auto vec = std::vector{0, 1, 2, 3};
+
+    const auto rng = vec
+        | genex::to<std::vector>(scratch.allocator<int>());
+    EXPECT_TRUE(std::ranges::equal(rng, vec));
+    EXPECT_EQ(rng.get_allocator().resource(), &scratch);
+}
+
+
+TEST(GenexMemoryArena, ResetRewinds) {
+    auto scratch = genex::arena(1024);
+    auto *first = scratch.allocate(64, alignof(int));
+    scratch.reset();
+    auto *second = scratch.allocate(64, alignof(int));
+    EXPECT_EQ(first, second);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.span;
+import genex.to_container;
+import genex.views2.chunk_by;
+import std;
+
+
+TEST(GenexViewsChunkBy, AscendingRuns) {
+    const auto vec = std::vector{1, 2, 3, 2, 4, 1, 1};
+
+    auto groups = std::vector<std::vector<int>>();
+    for (auto g : vec | genex::views::chunk_by([](int a, int b) { return a < b; })) {
+        groups.emplace_back(g.begin(), g.end());
+    }
+    const auto exp = std::vector<std::vector<int>>{{1, 2, 3}, {2, 4}, {1}, {1}};
+    EXPECT_EQ(groups, exp);
+}
+
+
+TEST(GenexViewsChunkBy, ContiguousSourceYieldsSpans) {
+    const auto vec = std::vector{5, 5, 6};
+    auto rng = genex::views::chunk_by(vec, std::equal_to{});
+    auto it = rng.begin();
+    static_assert(std::same_as<decltype(*it), genex::span<int const>>);
+
+    EXPECT_EQ((*it).data(), vec.data());
+    EXPECT_EQ((*it).size(), 2);
+    ++it;
+    EXPECT_EQ((*it).data(), vec.data() + 2);
+    EXPECT_EQ((*it).size(), 1);
+    ++it;
+    EXPECT_TRUE(it == rng.end());
+}
+
+
+TEST(GenexViewsChunkBy, ListSourceYieldsSubranges) {
+    const auto lst = std::list{1, 1, 2, 3, 3, 3};
+
+    auto sizes = std::vector<std::size_t>();
+    for (auto g : lst | genex::views::chunk_by(std::equal_to{})) {
+        sizes.push_back(static_cast<std::size_t>(std::ranges::distance(g)));
+    }
+    EXPECT_EQ(sizes, (std::vector<std::size_t>{2, 1, 3}));
+}
+
+
+TEST(GenexViewsChunkBy, Empty) {
+    const auto vec = std::vector<int>{};
+    auto count = 0;
+    for ([[maybe_unused]] auto g : vec | genex::views::chunk_by(std::equal_to{})) { ++count; }
+    EXPECT_EQ(count, 0);
+}
+
+
+TEST(GenexViewsGroupAdjacent, SessionsByUser) {
+    struct click {
+        int user;
+        int page;
+    };
+    const auto clicks = std::vector<click>{{1, 10}, {1, 11}, {2, 10}, {3, 12}, {3, 10}, {3, 11}, {1, 13}};
+
+    auto sessions = std::vector<std::pair<int, std::size_t>>();
+    for (auto s : clicks | genex::views::group_adjacent(&click::user)) {
+        sessions.emplace_back(s.begin()->user, s.size());
+    }
+    const auto exp = std::vector<std::pair<int, std::size_t>>{{1, 2}, {2, 1}, {3, 3}, {1, 1}};
+    EXPECT_EQ(sessions, exp);
+}
+
+
+TEST(GenexViewsGroupAdjacent, IdentityKey) {
+    const auto vec = std::vector{7, 7, 8, 7};
+
+    auto firsts = std::vector<int>();
+    for (auto g : vec | genex::views::group_adjacent) { firsts.push_back(*g.begin()); }
+    EXPECT_EQ(firsts, (std::vector{7, 8, 7}));
+}
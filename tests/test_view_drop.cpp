@@ -5,6 +5,7 @@ import genex.to_container;
 import genex.views2.drop;
 import genex.views2.drop_last;
 import genex.views2.drop_while;
+import genex.views2.move;
 
 
 TEST(GenexViewsDrop, VecInput) {
@@ -41,6 +42,29 @@ TEST(GenexViewsDropLast, VecInput) {
 }
 
 
+TEST(GenexViewsDropLast, SinglePassInput) {
+    auto vec = std::vector<std::string>{"a", "b", "c", "d", "e"};
+
+    const auto rng = vec
+        | genex::views::move
+        | genex::views::drop_last(2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::string>{"a", "b", "c"};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsDropLast, SinglePassInputEdgeCounts) {
+    auto vec = std::vector{0, 1, 2};
+
+    const auto none = vec | genex::views::move | genex::views::drop_last(0) | genex::to<std::vector>();
+    EXPECT_EQ(none, vec);
+
+    const auto all = vec | genex::views::move | genex::views::drop_last(3) | genex::to<std::vector>();
+    EXPECT_TRUE(all.empty());
+}
+
+
 TEST(GenexViewsDropWhile, VecInput) {
     auto vec = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
 
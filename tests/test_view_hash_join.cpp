@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.to_container;
+import genex.views2.hash_join;
+import std;
+
+namespace {
+    struct dimension {
+        int id;
+        std::string name;
+    };
+
+    struct event {
+        int dim_id;
+        int value;
+    };
+}
+
+
+TEST(GenexViewsHashJoin, InnerJoinPairsEveryMatch) {
+    const auto dims = std::vector<dimension>{{1, "a"}, {2, "b"}, {2, "b2"}, {4, "d"}};
+    const auto events = std::vector<event>{{2, 10}, {3, 20}, {1, 30}, {2, 40}};
+
+    auto out = std::vector<std::pair<std::string, int>>();
+    for (auto [dim, ev] : genex::views::hash_join(dims, events, &dimension::id, &event::dim_id)) {
+        out.emplace_back(dim.name, ev.value);
+    }
+    const auto exp = std::vector<std::pair<std::string, int>>{{"b", 10}, {"b2", 10}, {"a", 30}, {"b", 40}, {"b2", 40}};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexViewsHashJoin, YieldsReferences) {
+    auto build = std::vector<std::pair<int, int>>{{1, 0}, {2, 0}, {3, 0}};
+    auto probe = std::vector{3, 3, 1};
+
+    for (auto [b, p] : genex::views::hash_join(build, probe, &std::pair<int, int>::first)) {
+        b.second += 1;
+        p += 100;
+    }
+    EXPECT_EQ(build, (std::vector<std::pair<int, int>>{{1, 1}, {2, 0}, {3, 2}}));
+    EXPECT_EQ(probe, (std::vector{103, 103, 101}));
+}
+
+
+TEST(GenexViewsHashJoin, PipeWithReferenceToProbe) {
+    auto build = std::vector<std::pair<int, int>>{{1, 0}, {2, 0}, {3, 0}};
+    auto probe = std::vector{3, 3, 1};
+
+    auto view = build | genex::views::hash_join(std::ref(probe), &std::pair<int, int>::first);
+    for (auto [b, p] : view) {
+        b.second += 1;
+        p += 100;
+    }
+    EXPECT_EQ(build, (std::vector<std::pair<int, int>>{{1, 1}, {2, 0}, {3, 2}}));
+    EXPECT_EQ(probe, (std::vector{103, 103, 101}));
+}
+
+
+TEST(GenexViewsHashJoin, SemiJoin) {
+    const auto build = std::vector{5, 5, 7};
+    const auto probe = std::vector{1, 5, 6, 7, 5};
+
+    const auto rng = genex::views::hash_semi_join(build, probe)
+        | genex::to<std::vector>();
+    EXPECT_EQ(rng, (std::vector{5, 7, 5}));
+}
+
+
+TEST(GenexViewsHashJoin, AntiJoin) {
+    const auto build = std::vector<std::string>{"x", "y"};
+    const auto probe = std::vector<std::string>{"w", "x", "z", "y", "z"};
+
+    const auto rng = genex::views::hash_anti_join(build, probe)
+        | genex::to<std::vector>();
+    EXPECT_EQ(rng, (std::vector<std::string>{"w", "z", "z"}));
+}
+
+
+TEST(GenexViewsHashJoin, EmptyBuildSide) {
+    const auto build = std::vector<int>{};
+    const auto probe = std::vector{1, 2};
+
+    EXPECT_TRUE((genex::views::hash_join(build, probe) | genex::to<std::vector>()).empty());
+    EXPECT_EQ(genex::views::hash_anti_join(build, probe) | genex::to<std::vector>(), probe);
+}
+
+
+TEST(GenexViewsHashJoin, ManyKeys) {
+    auto build = std::vector<int>();
+    for (auto i = 0; i < 5000; ++i) { build.push_back(i * 1024); }
+    auto probe = std::vector<int>();
+    for (auto i = 0; i < 10000; ++i) { probe.push_back(i * 512); }
+
+    const auto rng = genex::views::hash_semi_join(build, probe)
+        | genex::to<std::vector>();
+    EXPECT_EQ(rng, build);
+}
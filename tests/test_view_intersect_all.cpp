@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.operations.cmp;
+import genex.to_container;
+import genex.views2.intersect_all;
+import std;
+
+
+TEST(GenexViewsIntersectAll, ThreeVecInput) {
+    auto vec1 = std::vector{1, 3, 4, 7, 9, 12, 15};
+    auto vec2 = std::vector{3, 4, 5, 9, 15, 20};
+    auto vec3 = std::vector{0, 4, 9, 10, 15};
+
+    const auto rng = genex::views::intersect_all(vec1, vec2, vec3)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{4, 9, 15};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsIntersectAll, MixedRangeTypes) {
+    auto vec = std::vector{1, 2, 3, 4, 5, 6, 7, 8};
+    auto arr = std::array{2, 4, 6, 8};
+    auto lst = std::list{4, 8, 12};
+
+    const auto rng = genex::views::intersect_all(vec, arr, lst)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{4, 8};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsIntersectAll, Multiplicity) {
+    auto vec1 = std::vector{2, 2, 2, 5};
+    auto vec2 = std::vector{2, 2, 5, 5};
+
+    const auto rng = genex::views::intersect_all(vec1, vec2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{2, 2, 5};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsIntersectAll, PostingLists) {
+    auto postings = std::vector<std::vector<std::uint32_t>>(3);
+    for (auto i = 0u; i < 100'000; ++i) { postings[0].push_back(i); }
+    for (auto i = 0u; i < 100'000; i += 3) { postings[1].push_back(i); }
+    postings[2] = {5, 6, 300, 301, 99'999};
+
+    const auto rng = postings
+        | genex::views::intersect_all
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::uint32_t>{6, 300, 99'999};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsIntersectAll, RuntimeWithEmptyList) {
+    auto postings = std::vector<std::vector<int>>{{1, 2, 3}, {}, {2, 3}};
+
+    const auto rng = postings
+        | genex::views::intersect_all
+        | genex::to<std::vector>();
+    EXPECT_TRUE(rng.empty());
+}
+
+
+TEST(GenexViewsIntersectAll, RuntimeComparatorAndProjection) {
+    auto lists = std::vector<std::vector<int>>{{9, 7, 5, 3}, {8, 7, 6, 3}, {7, 3, 1}};
+
+    const auto rng = lists
+        | genex::views::intersect_all(genex::operations::gt{})
+        | genex::to<std::vector>();
+    const auto exp = std::vector{7, 3};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsIntersectAll, ComparatorAndProjection) {
+    using entry = std::pair<int, char>;
+    auto vec1 = std::vector<entry>{{9, 'a'}, {7, 'b'}, {4, 'c'}, {2, 'd'}};
+    auto vec2 = std::vector<entry>{{8, 'e'}, {7, 'f'}, {2, 'g'}};
+    auto vec3 = std::vector<entry>{{7, 'h'}, {3, 'i'}, {2, 'j'}, {1, 'k'}};
+
+    const auto rng = genex::views::intersect_all(vec1, vec2, vec3, genex::operations::gt{}, &entry::first)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<entry>{{7, 'b'}, {2, 'd'}};
+    EXPECT_EQ(rng, exp);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.operations.cmp;
+import genex.to_container;
+import genex.views2.merge;
+
+
+TEST(GenexViewsMerge, TwoVecInput) {
+    auto vec1 = std::vector{1, 3, 5, 7, 9};
+    auto vec2 = std::vector{2, 4, 6, 8};
+
+    const auto rng = vec1
+        | genex::views::merge(vec2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsMerge, ManyVecInput) {
+    auto vec1 = std::vector{1, 5, 9};
+    auto vec2 = std::vector<int>{};
+    auto vec3 = std::vector{0, 2, 10, 11};
+    auto vec4 = std::vector{3, 3, 4};
+
+    const auto rng = genex::views::merge(vec1, vec2, vec3, vec4)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{0, 1, 2, 3, 3, 4, 5, 9, 10, 11};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsMerge, ComparatorAndProjection) {
+    auto vec1 = std::vector<std::string>{"ccc", "bb", "a"};
+    auto vec2 = std::vector<std::string>{"dddd", "ee", "f"};
+
+    const auto rng = genex::views::merge(vec1, vec2, genex::operations::gt{}, &std::string::size)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::string>{"dddd", "ccc", "bb", "ee", "a", "f"};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsMerge, YieldsReferences) {
+    auto vec1 = std::vector{1, 4};
+    auto vec2 = std::vector{2, 3};
+
+    for (auto &x : genex::views::merge(vec1, vec2)) { x *= 10; }
+    EXPECT_EQ(vec1, (std::vector{10, 40}));
+    EXPECT_EQ(vec2, (std::vector{20, 30}));
+}
+
+
+TEST(GenexViewsMergeAll, RuntimeRuns) {
+    auto runs = std::vector<std::vector<int>>{{4, 8, 12}, {}, {1, 2, 3}, {5}, {0, 13}};
+
+    const auto rng = runs
+        | genex::views::merge_all
+        | genex::to<std::vector>();
+    const auto exp = std::vector{0, 1, 2, 3, 4, 5, 8, 12, 13};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsMergeAll, StableAcrossRuns) {
+    auto runs = std::vector<std::vector<std::pair<int, char>>>{
+        {{1, 'a'}, {2, 'a'}}, {{1, 'b'}, {2, 'b'}}, {{1, 'c'}}};
+
+    const auto rng = runs
+        | genex::views::merge_all(genex::operations::lt{}, &std::pair<int, char>::first)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::pair<int, char>>{{1, 'a'}, {1, 'b'}, {1, 'c'}, {2, 'a'}, {2, 'b'}};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsMergeAll, NoRuns) {
+    auto runs = std::vector<std::vector<int>>{};
+
+    const auto rng = runs
+        | genex::views::merge_all
+        | genex::to<std::vector>();
+    EXPECT_TRUE(rng.empty());
+}
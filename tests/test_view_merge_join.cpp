@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.to_container;
+import genex.views2.merge_join;
+import std;
+
+
+TEST(GenexViewsMergeJoin, CrossProductOfEqualRuns) {
+    const auto lhs = std::vector<std::pair<int, char>>{{1, 'a'}, {2, 'b'}, {2, 'c'}, {4, 'd'}, {5, 'e'}};
+    const auto rhs = std::vector<std::pair<int, int>>{{0, 0}, {2, 20}, {2, 21}, {3, 30}, {5, 50}};
+
+    auto out = std::vector<std::tuple<int, char, int>>();
+    for (auto [l, r] : genex::views::merge_join(lhs, rhs, &std::pair<int, char>::first, &std::pair<int, int>::first)) {
+        out.emplace_back(l.first, l.second, r.second);
+    }
+    const auto exp = std::vector<std::tuple<int, char, int>>{
+        {2, 'b', 20}, {2, 'b', 21}, {2, 'c', 20}, {2, 'c', 21}, {5, 'e', 50}};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexViewsMergeJoin, PipeAndIdentityKeys) {
+    const auto lhs = std::vector{1, 3, 3, 7};
+    const auto rhs = std::vector{3, 7, 7, 9};
+
+    auto out = std::vector<std::pair<int, int>>();
+    for (auto [l, r] : lhs | genex::views::merge_join(rhs)) { out.emplace_back(l, r); }
+    const auto exp = std::vector<std::pair<int, int>>{{3, 3}, {3, 3}, {7, 7}, {7, 7}};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexViewsMergeJoin, LeftOuterKeepsUnmatched) {
+    const auto lhs = std::vector{1, 2, 2, 4};
+    const auto rhs = std::vector{2, 3, 4, 4};
+
+    auto out = std::vector<std::pair<int, int>>();
+    for (auto [l, r] : genex::views::merge_left_join(lhs, rhs)) {
+        out.emplace_back(l, r ? *r : -1);
+    }
+    const auto exp = std::vector<std::pair<int, int>>{{1, -1}, {2, 2}, {2, 2}, {4, 4}, {4, 4}};
+    EXPECT_EQ(out, exp);
+}
+
+
+TEST(GenexViewsMergeJoin, DescendingOrder) {
+    const auto lhs = std::vector{9, 5, 1};
+    const auto rhs = std::vector{9, 9, 1};
+
+    auto count = 0;
+    for (auto [l, r] : genex::views::merge_join(lhs, rhs, {}, {}, std::greater{})) {
+        EXPECT_EQ(l, r);
+        ++count;
+    }
+    EXPECT_EQ(count, 3);
+}
+
+
+TEST(GenexViewsMergeJoin, EmptyInputs) {
+    const auto lhs = std::vector{1, 2};
+    const auto rhs = std::vector<int>{};
+
+    auto inner = 0;
+    for ([[maybe_unused]] auto [l, r] : genex::views::merge_join(lhs, rhs)) { ++inner; }
+    EXPECT_EQ(inner, 0);
+
+    auto outer = 0;
+    for (auto [l, r] : genex::views::merge_left_join(lhs, rhs)) {
+        EXPECT_EQ(r, nullptr);
+        ++outer;
+    }
+    EXPECT_EQ(outer, 2);
+}
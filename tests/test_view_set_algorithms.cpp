@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.operations.cmp;
+import genex.to_container;
+import genex.views2.set_algorithms;
+
+
+TEST(GenexViewsSetAlgorithms, Difference) {
+    auto vec1 = std::vector{1, 2, 2, 3, 5, 8};
+    auto vec2 = std::vector{2, 3, 4};
+
+    const auto rng = vec1
+        | genex::views::set_difference(vec2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{1, 2, 5, 8};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsSetAlgorithms, Intersection) {
+    auto vec1 = std::vector{1, 2, 2, 3, 5, 8};
+    auto vec2 = std::vector{2, 2, 3, 4, 8, 9};
+
+    const auto rng = vec1
+        | genex::views::set_intersection(vec2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{2, 2, 3, 8};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsSetAlgorithms, SymmetricDifference) {
+    auto vec1 = std::vector{1, 2, 3, 5};
+    auto vec2 = std::vector{2, 4, 5, 6};
+
+    const auto rng = vec1
+        | genex::views::set_symmetric_difference(vec2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{1, 3, 4, 6};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsSetAlgorithms, Union) {
+    auto vec1 = std::vector{1, 3, 5};
+    auto vec2 = std::vector{2, 3, 4};
+
+    const auto rng = vec1
+        | genex::views::set_union(vec2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{1, 2, 3, 4, 5};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsSetAlgorithms, YieldsReferences) {
+    auto vec1 = std::vector{1, 3, 5, 7};
+    auto vec2 = std::vector{3, 7};
+
+    for (auto &x : genex::views::set_intersection(vec1, vec2)) { x = -x; }
+    EXPECT_EQ(vec1, (std::vector{1, -3, 5, -7}));
+    EXPECT_EQ(vec2, (std::vector{3, 7}));
+}
+
+
+TEST(GenexViewsSetAlgorithms, SkewedIntersection) {
+    auto big = std::vector<int>(1'000'000);
+    for (auto i = 0; i < 1'000'000; ++i) { big[i] = 2 * i; }
+    auto small = std::vector{-1, 6, 7, 1'000'000, 1'999'998, 2'000'001};
+
+    auto comparisons = 0uz;
+    auto counting_lt = [&comparisons](int a, int b) { ++comparisons; return a < b; };
+    const auto rng = genex::views::set_intersection(small, big, counting_lt)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{6, 1'000'000, 1'999'998};
+    EXPECT_EQ(rng, exp);
+    EXPECT_LT(comparisons, 1000);
+}
+
+
+TEST(GenexViewsSetAlgorithms, ComparatorAndProjection) {
+    auto vec1 = std::vector<std::string>{"ccc", "bb", "a"};
+    auto vec2 = std::vector<std::string>{"dddd", "xx", "y"};
+
+    const auto rng = genex::views::set_intersection(vec1, vec2, genex::operations::gt{}, &std::string::size, &std::string::size)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::string>{"bb", "a"};
+    EXPECT_EQ(rng, exp);
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.operations.cmp;
+import genex.to_container;
+import genex.views2.sort_lazy;
+import genex.views2.take;
+
+
+TEST(GenexViewsSortLazy, VecInput) {
+    auto vec = std::vector{7, 4, 5, 6, 3, 2, 1, 4, 9, 0, 8};
+
+    const auto rng = vec
+        | genex::views::sort_lazy
+        | genex::to<std::vector>();
+    const auto exp = std::vector{0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsSortLazy, FirstPageOnly) {
+    auto vec = std::vector<int>(1000);
+    for (auto i = 0; i < 1000; ++i) { vec[i] = (i * 7919) % 1000; }
+
+    const auto rng = vec
+        | genex::views::sort_lazy(genex::operations::gt{})
+        | genex::views::take(5)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{999, 998, 997, 996, 995};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsSortLazy, ManyDuplicates) {
+    auto vec = std::vector<int>(200);
+    for (auto i = 0; i < 200; ++i) { vec[i] = i % 3; }
+
+    auto view = genex::views::sort_lazy(vec);
+    auto it = view.begin();
+    for (auto i = 0; i < 200; ++i, ++it) { EXPECT_EQ(*it, i < 67 ? 0 : (i < 134 ? 1 : 2)); }
+    EXPECT_TRUE(it == view.end());
+}
@@ -2,6 +2,7 @@
 #include <coroutine>
 
 import genex.to_container;
+import genex.views2.move;
 import genex.views2.take;
 import genex.views2.take_last;
 import genex.views2.take_while;
@@ -29,6 +30,30 @@ TEST(GenexViewsTakeLast, VecInput) {
 }
 
 
+TEST(GenexViewsTakeLast, SinglePassInput) {
+    auto vec = std::vector<std::string>{"a", "b", "c", "d", "e"};
+
+    const auto rng = vec
+        | genex::views::move
+        | genex::views::take_last(2)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::string>{"d", "e"};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsTakeLast, SinglePassInputShorterThanN) {
+    auto vec = std::vector{0, 1, 2};
+
+    const auto rng = vec
+        | genex::views::move
+        | genex::views::take_last(5)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{0, 1, 2};
+    EXPECT_EQ(rng, exp);
+}
+
+
 TEST(GenexViewsTakeWhile, VecInput) {
     auto vec = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
 
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <coroutine>
+
+import genex.actions.nth_element;
+import genex.actions.partial_sort;
+import genex.operations.cmp;
+import genex.to_container;
+import genex.views2.move;
+import genex.views2.top_k;
+
+
+TEST(GenexViewsTopK, VecInput) {
+    auto vec = std::vector{7, 4, 5, 6, 3, 2, 1, 4, 9, 0, 8};
+
+    const auto rng = vec
+        | genex::views::top_k(3)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{9, 8, 7};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsTopK, VecInputSmallestByProjection) {
+    auto vec = std::vector<std::string>{"dddd", "a", "ccc", "bb", "eeeee"};
+
+    const auto rng = vec
+        | genex::views::move
+        | genex::views::top_k(2, genex::operations::lt{}, &std::string::size)
+        | genex::to<std::vector>();
+    const auto exp = std::vector<std::string>{"a", "bb"};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexViewsTopK, KLargerThanInput) {
+    auto vec = std::vector{2, 3, 1};
+
+    const auto rng = vec
+        | genex::views::top_k(10)
+        | genex::to<std::vector>();
+    const auto exp = std::vector{3, 2, 1};
+    EXPECT_EQ(rng, exp);
+}
+
+
+TEST(GenexActionsPartialSort, VecInput) {
+    auto vec = std::vector{7, 4, 5, 6, 3, 2, 1, 4, 9, 0, 8};
+    vec |= genex::actions::partial_sort(4);
+    const auto exp = std::vector{0, 1, 2, 3};
+    EXPECT_EQ(std::vector(vec.begin(), vec.begin() + 4), exp);
+}
+
+
+TEST(GenexActionsNthElement, VecInput) {
+    auto vec = std::vector{7, 4, 5, 6, 3, 2, 1, 4, 9, 0, 8};
+    vec |= genex::actions::nth_element(5, genex::operations::gt{});
+    EXPECT_EQ(vec[5], 4);
+    for (auto i = 0; i < 5; ++i) { EXPECT_GE(vec[i], vec[5]); }
+    for (auto i = 6; i < 11; ++i) { EXPECT_LE(vec[i], vec[5]); }
+}
+
+
+TEST(GenexActionsPartialSort, KOutOfRangeIsClamped) {
+    auto vec = std::vector{3, 1, 2};
+    vec |= genex::actions::partial_sort(-1);
+    EXPECT_EQ(vec, (std::vector{3, 1, 2}));
+    vec |= genex::actions::partial_sort(10u);
+    EXPECT_EQ(vec, (std::vector{1, 2, 3}));
+}
+
+
+TEST(GenexActionsNthElement, NegativeKLeavesRangeUntouched) {
+    auto vec = std::vector{3, 1, 2};
+    vec |= genex::actions::nth_element(-1);
+    EXPECT_EQ(vec, (std::vector{3, 1, 2}));
+}
+
+
+TEST(GenexViewsTopK, NegativeKIsEmpty) {
+    auto vec = std::vector{2, 3, 1};
+
+    const auto rng = vec
+        | genex::views::top_k(-1)
+        | genex::to<std::vector>();
+    EXPECT_TRUE(rng.empty());
+}